@@ -20,7 +20,7 @@
 #include "types.h"
 #include "DVP.h"
 
-void TP_Callback(void *param, uint8_t address, uint16_t size, uint8_t *payload)
+void TP_Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
 {
 	DVP_Context * ctx = param;
 	ctx->frame = (DVP_Frame *) payload;
@@ -56,7 +56,7 @@ bool DVP_Init(DVP_Obj *obj, const void *port, DVP_Driver *driver, uint8_t * buff
 	offset += ctx->workBufferLen;
 	TP_ASSERT(offset >= size);
 
-	ctx->tp = (TP_Obj * )buffer + offset;
+	ctx->tp = (TP_Obj * )(buffer + offset);
 	offset += sizeof(TP_Obj);
 	TP_ASSERT(offset >= size);
 
@@ -0,0 +1,110 @@
+/*!
+ * @file Bench.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Command round trips between a client and a server in the same process,
+ *  reported as JSON by make bench.
+ */
+
+#include <DVP.h>
+#include <stdio.h>
+
+#include "BenchReport.h"
+
+#define BATCH		16
+
+typedef struct
+{
+	DVP_Obj obj;
+	uint8_t buffer[4096];
+	uint32_t responses;
+}BenchPeer;
+
+static DVP_VehicleStatus status = { .poweredOn = true, .headLightOn = true, .speed = 3315 };
+static DVP_VehicleConfig config = { .brakeLevel = 5, .throttleLevel = 5, .startSpeed = 300, .speedLimit = 2700 };
+static DVP_FirmwareUpdateLoadPacket load = { .sequence = 0, .size = sizeof(load.content) };
+
+static void Command(void *param, uint8_t address, DVP_Frame *data)
+{
+	BenchPeer *server = (BenchPeer *)param;
+
+	switch(data->id)
+	{
+	case DVP_eReadVehicleStatus:
+		DVP_ReplyReadVehicleStatus(&server->obj, DVP_OK, &status);
+		break;
+	case DVP_eWriteVehicleConfig:
+		memcpy(&config, &data->payload.vehicleConfig, sizeof(config));
+		DVP_ReplyWriteVehicleConfig(&server->obj, DVP_OK);
+		break;
+	case DVP_eFirmwareUpdateLoad:
+		DVP_ReplyFirmwareUpdateLoad(&server->obj, DVP_OK);
+		break;
+	default:
+		break;
+	}
+}
+
+static void Response(void *param, uint8_t address, DVP_Frame *data)
+{
+	((BenchPeer *)param)->responses++;
+}
+
+/* Both peers only run once their frame is in the loopback, the clock doesn't move */
+static void BenchCommand(const char *name, uint32_t size, DVP_StatusCode (*send)(BenchPeer *client))
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * 4096];
+	static BenchPeer client, server;
+	double start = 0;
+	double elapsed = 0;
+
+	TP_LoopbackInit(&loopback, queues, sizeof(queues));
+	DVP_Init(&client.obj, TP_LoopbackPort(&loopback, TP_LOOPBACK_A), (DVP_Driver *)&TP_LoopbackDriver,
+			client.buffer, sizeof(client.buffer));
+	DVP_Init(&server.obj, TP_LoopbackPort(&loopback, TP_LOOPBACK_B), (DVP_Driver *)&TP_LoopbackDriver,
+			server.buffer, sizeof(server.buffer));
+	DVP_RegisterResponseCallback(&client.obj, Response, &client);
+	DVP_RegisterCommandCallback(&server.obj, Command, &server);
+	client.responses = 0;
+
+	start = BenchSeconds();
+	while((elapsed = BenchSeconds() - start) < BENCH_TIME)
+	{
+		for(uint32_t i = 0; i < BATCH && send(&client) == DVP_OK; i++)
+		{
+			DVP_Run(&server.obj);
+			DVP_Run(&client.obj);
+		}
+	}
+
+	BenchResult(name, size, elapsed * 1e9 / client.responses, "ns/roundtrip");
+}
+
+static DVP_StatusCode SendReadVehicleStatus(BenchPeer *client)
+{
+	return DVP_ReadVehicleStatusAsync(&client->obj);
+}
+
+static DVP_StatusCode SendWriteVehicleConfig(BenchPeer *client)
+{
+	return DVP_WriteVehicleConfigAsync(&client->obj, &config);
+}
+
+static DVP_StatusCode SendFirmwareUpdateLoad(BenchPeer *client)
+{
+	return DVP_FirmwareUpdateLoadAsync(&client->obj, &load);
+}
+
+int main(int argc, char** argv)
+{
+	BenchBegin("DVP", (argc > 1) ? argv[1] : NULL);
+	BenchCommand("dvp_read_vehicle_status", 0, SendReadVehicleStatus);
+	BenchCommand("dvp_write_vehicle_config", sizeof(DVP_VehicleConfig), SendWriteVehicleConfig);
+	BenchCommand("dvp_firmware_update_load", sizeof(DVP_FirmwareUpdateLoadPacket), SendFirmwareUpdateLoad);
+	BenchEnd();
+
+	return 0;
+}
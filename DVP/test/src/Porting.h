@@ -17,8 +17,8 @@ extern "C" {
 #define __USE_MISC
 
 void * UART_Open(const void *port);
-uint16_t UART_Write(void *handle, const void *buffer, uint16_t size);
-uint16_t UART_Read(void *handle, void *buffer, uint16_t size);
+uint32_t UART_Write(void *handle, const void *buffer, uint32_t size);
+uint32_t UART_Read(void *handle, void *buffer, uint32_t size);
 uint16_t UART_Close(void *handle);
 void     UART_Flush(void *handle);
 uint32_t SYS_Tick();
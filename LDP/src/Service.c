@@ -20,7 +20,7 @@
 #include "types.h"
 #include "LDP.h"
 
-void TP_Callback(void *param, uint8_t address, uint16_t size, uint8_t *payload)
+void TP_Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
 {
 	LDP_Context * ctx = param;
 	ctx->frame = (LDP_Frame *) payload;
@@ -56,7 +56,7 @@ bool LDP_Init(LDP_Obj *obj, const void *port, LDP_Driver *driver, uint8_t * buff
 	offset += ctx->workBufferLen;
 	TP_ASSERT(offset >= size);
 
-	ctx->tp = (TP_Obj * )buffer + offset;
+	ctx->tp = (TP_Obj * )(buffer + offset);
 	offset += sizeof(TP_Obj);
 	TP_ASSERT(offset >= size);
 
@@ -185,6 +185,11 @@ LDP_StatusCode LDP_Command2(LDP_Obj *obj, st_cmd2 *data)
 	return LDP_SendGeneric(obj, true, LDP_FrameCommand, LDP_Cmd2, LDP_OK, NULL, 0, data, &size);
 }
 
+LDP_StatusCode LDP_Command2Async(LDP_Obj *obj)
+{
+	return LDP_SendGeneric(obj, false, LDP_FrameCommand, LDP_Cmd2, LDP_OK, NULL, 0, NULL, 0);
+}
+
 LDP_StatusCode LDP_Response1(LDP_Obj *obj, LDP_StatusCode statusCode)
 {
 	return LDP_SendGeneric(obj, false, LDP_FrameResponse, LDP_Cmd1, statusCode, NULL, 0, NULL, 0);
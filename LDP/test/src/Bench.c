@@ -0,0 +1,99 @@
+/*!
+ * @file Bench.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Command round trips between a client and a server in the same process,
+ *  reported as JSON by make bench.
+ */
+
+#include <LDP.h>
+#include <stdio.h>
+
+#include "BenchReport.h"
+
+#define BATCH		16
+
+typedef struct
+{
+	LDP_Obj obj;
+	uint8_t buffer[4096];
+	uint32_t responses;
+}BenchPeer;
+
+static st_cmd1 cmd1 = { .field1 = 55, .field2 = 27 };
+static st_cmd2 cmd2 = { .field1 = 155, .field2 = 127, .field3 = 35645 };
+
+static void Command(void *param, uint8_t address, LDP_Frame *data)
+{
+	BenchPeer *server = (BenchPeer *)param;
+
+	switch(data->id)
+	{
+	case LDP_Cmd1:
+		LDP_Response1(&server->obj, LDP_OK);
+		break;
+	case LDP_Cmd2:
+		LDP_Response2(&server->obj, LDP_OK, &cmd2);
+		break;
+	default:
+		break;
+	}
+}
+
+static void Response(void *param, uint8_t address, LDP_Frame *data)
+{
+	((BenchPeer *)param)->responses++;
+}
+
+/* Both peers only run once their frame is in the loopback, the clock doesn't move */
+static void BenchCommand(const char *name, uint32_t size, LDP_StatusCode (*send)(BenchPeer *client))
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * 4096];
+	static BenchPeer client, server;
+	double start = 0;
+	double elapsed = 0;
+
+	TP_LoopbackInit(&loopback, queues, sizeof(queues));
+	LDP_Init(&client.obj, TP_LoopbackPort(&loopback, TP_LOOPBACK_A), (LDP_Driver *)&TP_LoopbackDriver,
+			client.buffer, sizeof(client.buffer));
+	LDP_Init(&server.obj, TP_LoopbackPort(&loopback, TP_LOOPBACK_B), (LDP_Driver *)&TP_LoopbackDriver,
+			server.buffer, sizeof(server.buffer));
+	LDP_RegisterResponseCallback(&client.obj, Response, &client);
+	LDP_RegisterCommandCallback(&server.obj, Command, &server);
+	client.responses = 0;
+
+	start = BenchSeconds();
+	while((elapsed = BenchSeconds() - start) < BENCH_TIME)
+	{
+		for(uint32_t i = 0; i < BATCH && send(&client) == LDP_OK; i++)
+		{
+			LDP_Run(&server.obj);
+			LDP_Run(&client.obj);
+		}
+	}
+
+	BenchResult(name, size, elapsed * 1e9 / client.responses, "ns/roundtrip");
+}
+
+static LDP_StatusCode SendCommand1(BenchPeer *client)
+{
+	return LDP_Command1Async(&client->obj, &cmd1);
+}
+
+static LDP_StatusCode SendCommand2(BenchPeer *client)
+{
+	return LDP_Command2Async(&client->obj);
+}
+
+int main(int argc, char** argv)
+{
+	BenchBegin("LDP", (argc > 1) ? argv[1] : NULL);
+	BenchCommand("ldp_command1", sizeof(st_cmd1), SendCommand1);
+	BenchCommand("ldp_command2", sizeof(st_cmd2), SendCommand2);
+	BenchEnd();
+
+	return 0;
+}
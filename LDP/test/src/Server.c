@@ -36,7 +36,8 @@ LDP_Driver driver =
 		.Close = UART_Close,
 		.Flush = UART_Flush,
 		.Tick = SYS_Tick,
-		.Sleep = SYS_Sleep
+		.Sleep = SYS_Sleep,
+		.Wait = UART_Wait
 };
 
 void Command(void *param, uint8_t address, LDP_Frame *data)
@@ -20,7 +20,7 @@
 #include "types.h"
 #include "Template.h"
 
-void TP_Callback(void *param, uint8_t address, uint16_t size, uint8_t *payload)
+void TP_Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
 {
 	T_Context * ctx = param;
 	ctx->frame = (T_Frame *) payload;
@@ -56,7 +56,7 @@ bool T_Init(T_Obj *obj, const void *port, T_Driver *driver, uint8_t * buffer, ui
 	offset += ctx->workBufferLen;
 	TP_ASSERT(offset >= size);
 
-	ctx->tp = (TP_Obj * )buffer + offset;
+	ctx->tp = (TP_Obj * )(buffer + offset);
 	offset += sizeof(TP_Obj);
 	TP_ASSERT(offset >= size);
 
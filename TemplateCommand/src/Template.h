@@ -132,7 +132,7 @@ typedef struct T_Driver
 	 *
 	 * @return Amount of data written.
 	 */
-	uint16_t ( *Write)(void *handle, const void *buffer, uint16_t size);
+	uint32_t ( *Write)(void *handle, const void *buffer, uint32_t size);
 
 	/*!
 	 * @brief Read raw data from port opened by T_Driver::Open
@@ -143,7 +143,7 @@ typedef struct T_Driver
 	 *
 	 * @return Amount of data read.
 	 */
-	uint16_t ( *Read )(void *handle, void *buffer, uint16_t size);
+	uint32_t ( *Read )(void *handle, void *buffer, uint32_t size);
 
 	/*!
 	 * @brief Close the port opened by T_Driver::Open
@@ -175,6 +175,36 @@ typedef struct T_Driver
 	 * @param[in] time to sleep
 	 */
 	void (*Sleep) (uint32_t time);
+
+	/*!
+	 * @brief Optional. Write several buffers at once, e.g. with writev or sendmsg.
+	 *
+	 * @param[in] handle Returned by T_Driver::Open.
+	 * @param[in] vector Buffers to be send in order.
+	 * @param[in] count  Amount of buffers.
+	 *
+	 * @return Amount of data written.
+	 */
+	uint32_t (*WriteV)(void *handle, const TP_IOVec *vector, uint8_t count);
+
+	/*!
+	 * @brief Optional. Blocks until there are bytes to be read or the deadline passes,
+	 * e.g. with poll, select or an event flag set by the RX interrupt.
+	 *
+	 * @details Used while a frame is awaited instead of calling Read and Tick in a loop.
+	 * Returning earlier is harmless, the wait is repeated until the timeout.
+	 *
+	 * @param[in] handle   Returned by T_Driver::Open.
+	 * @param[in] deadline Time returned by T_Driver::Tick when the wait gives up.
+	 *
+	 * @return true if there may be bytes to be read.
+	 */
+	bool (*Wait)(void *handle, uint32_t deadline);
+
+	/*!
+	 * @brief TP_DRIVER_* flags, 0 for a byte stream.
+	 */
+	uint32_t capabilities;
 }T_Driver;
 
 /*!
@@ -101,7 +101,7 @@ void * UART_Open(const void *port)
 	return &op;
 }
 
-uint16_t UART_Write(void *handle, const void *buffer, uint16_t size)
+uint32_t UART_Write(void *handle, const void *buffer, uint32_t size)
 {
 //	dumpBuffer((char*)buffer, size);
 	size = sendto(op.connfd, (const char *)buffer, size, MSG_WAITALL , (const struct sockaddr *)&op.cli_addr, sizeof(op.cli_addr));
@@ -109,7 +109,7 @@ uint16_t UART_Write(void *handle, const void *buffer, uint16_t size)
 	return size;
 }
 
-uint16_t UART_Read(void *handle, void *buffer, uint16_t size)
+uint32_t UART_Read(void *handle, void *buffer, uint32_t size)
 {
 
 	char _buffer[1024];
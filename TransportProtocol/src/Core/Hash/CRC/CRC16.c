@@ -5,7 +5,10 @@
  *      Eng. Douglas Reis
  */
 
+#include <string.h>
+
 #include "CRC16.h"
+#include "Clmul.h"
 
 
 const uint8_t auchCRCHi[256] =
@@ -68,36 +71,745 @@ const uint8_t auchCRCLo[256] =
 		0x43, 0x83, 0x41, 0x81, 0x80, 0x40
 };
 
-int16_t TP_CRC16(uint8_t *data, int32_t length)
+#if TP_CRC16_ENGINE >= TP_CRC_SLICING_8
+/*
+ * Reflected CRC16/Modbus table (polynomial 0xA001) for the slicing engines.
+ * Row n holds the CRC of a byte followed by n zero bytes.
+ */
+static const uint16_t TPCRC16Slices[TP_CRC16_ENGINE][256] =
+{
+		{
+			0x0000, 0xC0C1, 0xC181, 0x0140, 0xC301, 0x03C0, 0x0280, 0xC241,
+			0xC601, 0x06C0, 0x0780, 0xC741, 0x0500, 0xC5C1, 0xC481, 0x0440,
+			0xCC01, 0x0CC0, 0x0D80, 0xCD41, 0x0F00, 0xCFC1, 0xCE81, 0x0E40,
+			0x0A00, 0xCAC1, 0xCB81, 0x0B40, 0xC901, 0x09C0, 0x0880, 0xC841,
+			0xD801, 0x18C0, 0x1980, 0xD941, 0x1B00, 0xDBC1, 0xDA81, 0x1A40,
+			0x1E00, 0xDEC1, 0xDF81, 0x1F40, 0xDD01, 0x1DC0, 0x1C80, 0xDC41,
+			0x1400, 0xD4C1, 0xD581, 0x1540, 0xD701, 0x17C0, 0x1680, 0xD641,
+			0xD201, 0x12C0, 0x1380, 0xD341, 0x1100, 0xD1C1, 0xD081, 0x1040,
+			0xF001, 0x30C0, 0x3180, 0xF141, 0x3300, 0xF3C1, 0xF281, 0x3240,
+			0x3600, 0xF6C1, 0xF781, 0x3740, 0xF501, 0x35C0, 0x3480, 0xF441,
+			0x3C00, 0xFCC1, 0xFD81, 0x3D40, 0xFF01, 0x3FC0, 0x3E80, 0xFE41,
+			0xFA01, 0x3AC0, 0x3B80, 0xFB41, 0x3900, 0xF9C1, 0xF881, 0x3840,
+			0x2800, 0xE8C1, 0xE981, 0x2940, 0xEB01, 0x2BC0, 0x2A80, 0xEA41,
+			0xEE01, 0x2EC0, 0x2F80, 0xEF41, 0x2D00, 0xEDC1, 0xEC81, 0x2C40,
+			0xE401, 0x24C0, 0x2580, 0xE541, 0x2700, 0xE7C1, 0xE681, 0x2640,
+			0x2200, 0xE2C1, 0xE381, 0x2340, 0xE101, 0x21C0, 0x2080, 0xE041,
+			0xA001, 0x60C0, 0x6180, 0xA141, 0x6300, 0xA3C1, 0xA281, 0x6240,
+			0x6600, 0xA6C1, 0xA781, 0x6740, 0xA501, 0x65C0, 0x6480, 0xA441,
+			0x6C00, 0xACC1, 0xAD81, 0x6D40, 0xAF01, 0x6FC0, 0x6E80, 0xAE41,
+			0xAA01, 0x6AC0, 0x6B80, 0xAB41, 0x6900, 0xA9C1, 0xA881, 0x6840,
+			0x7800, 0xB8C1, 0xB981, 0x7940, 0xBB01, 0x7BC0, 0x7A80, 0xBA41,
+			0xBE01, 0x7EC0, 0x7F80, 0xBF41, 0x7D00, 0xBDC1, 0xBC81, 0x7C40,
+			0xB401, 0x74C0, 0x7580, 0xB541, 0x7700, 0xB7C1, 0xB681, 0x7640,
+			0x7200, 0xB2C1, 0xB381, 0x7340, 0xB101, 0x71C0, 0x7080, 0xB041,
+			0x5000, 0x90C1, 0x9181, 0x5140, 0x9301, 0x53C0, 0x5280, 0x9241,
+			0x9601, 0x56C0, 0x5780, 0x9741, 0x5500, 0x95C1, 0x9481, 0x5440,
+			0x9C01, 0x5CC0, 0x5D80, 0x9D41, 0x5F00, 0x9FC1, 0x9E81, 0x5E40,
+			0x5A00, 0x9AC1, 0x9B81, 0x5B40, 0x9901, 0x59C0, 0x5880, 0x9841,
+			0x8801, 0x48C0, 0x4980, 0x8941, 0x4B00, 0x8BC1, 0x8A81, 0x4A40,
+			0x4E00, 0x8EC1, 0x8F81, 0x4F40, 0x8D01, 0x4DC0, 0x4C80, 0x8C41,
+			0x4400, 0x84C1, 0x8581, 0x4540, 0x8701, 0x47C0, 0x4680, 0x8641,
+			0x8201, 0x42C0, 0x4380, 0x8341, 0x4100, 0x81C1, 0x8081, 0x4040
+		},
+		{
+			0x0000, 0x9001, 0x6001, 0xF000, 0xC002, 0x5003, 0xA003, 0x3002,
+			0xC007, 0x5006, 0xA006, 0x3007, 0x0005, 0x9004, 0x6004, 0xF005,
+			0xC00D, 0x500C, 0xA00C, 0x300D, 0x000F, 0x900E, 0x600E, 0xF00F,
+			0x000A, 0x900B, 0x600B, 0xF00A, 0xC008, 0x5009, 0xA009, 0x3008,
+			0xC019, 0x5018, 0xA018, 0x3019, 0x001B, 0x901A, 0x601A, 0xF01B,
+			0x001E, 0x901F, 0x601F, 0xF01E, 0xC01C, 0x501D, 0xA01D, 0x301C,
+			0x0014, 0x9015, 0x6015, 0xF014, 0xC016, 0x5017, 0xA017, 0x3016,
+			0xC013, 0x5012, 0xA012, 0x3013, 0x0011, 0x9010, 0x6010, 0xF011,
+			0xC031, 0x5030, 0xA030, 0x3031, 0x0033, 0x9032, 0x6032, 0xF033,
+			0x0036, 0x9037, 0x6037, 0xF036, 0xC034, 0x5035, 0xA035, 0x3034,
+			0x003C, 0x903D, 0x603D, 0xF03C, 0xC03E, 0x503F, 0xA03F, 0x303E,
+			0xC03B, 0x503A, 0xA03A, 0x303B, 0x0039, 0x9038, 0x6038, 0xF039,
+			0x0028, 0x9029, 0x6029, 0xF028, 0xC02A, 0x502B, 0xA02B, 0x302A,
+			0xC02F, 0x502E, 0xA02E, 0x302F, 0x002D, 0x902C, 0x602C, 0xF02D,
+			0xC025, 0x5024, 0xA024, 0x3025, 0x0027, 0x9026, 0x6026, 0xF027,
+			0x0022, 0x9023, 0x6023, 0xF022, 0xC020, 0x5021, 0xA021, 0x3020,
+			0xC061, 0x5060, 0xA060, 0x3061, 0x0063, 0x9062, 0x6062, 0xF063,
+			0x0066, 0x9067, 0x6067, 0xF066, 0xC064, 0x5065, 0xA065, 0x3064,
+			0x006C, 0x906D, 0x606D, 0xF06C, 0xC06E, 0x506F, 0xA06F, 0x306E,
+			0xC06B, 0x506A, 0xA06A, 0x306B, 0x0069, 0x9068, 0x6068, 0xF069,
+			0x0078, 0x9079, 0x6079, 0xF078, 0xC07A, 0x507B, 0xA07B, 0x307A,
+			0xC07F, 0x507E, 0xA07E, 0x307F, 0x007D, 0x907C, 0x607C, 0xF07D,
+			0xC075, 0x5074, 0xA074, 0x3075, 0x0077, 0x9076, 0x6076, 0xF077,
+			0x0072, 0x9073, 0x6073, 0xF072, 0xC070, 0x5071, 0xA071, 0x3070,
+			0x0050, 0x9051, 0x6051, 0xF050, 0xC052, 0x5053, 0xA053, 0x3052,
+			0xC057, 0x5056, 0xA056, 0x3057, 0x0055, 0x9054, 0x6054, 0xF055,
+			0xC05D, 0x505C, 0xA05C, 0x305D, 0x005F, 0x905E, 0x605E, 0xF05F,
+			0x005A, 0x905B, 0x605B, 0xF05A, 0xC058, 0x5059, 0xA059, 0x3058,
+			0xC049, 0x5048, 0xA048, 0x3049, 0x004B, 0x904A, 0x604A, 0xF04B,
+			0x004E, 0x904F, 0x604F, 0xF04E, 0xC04C, 0x504D, 0xA04D, 0x304C,
+			0x0044, 0x9045, 0x6045, 0xF044, 0xC046, 0x5047, 0xA047, 0x3046,
+			0xC043, 0x5042, 0xA042, 0x3043, 0x0041, 0x9040, 0x6040, 0xF041
+		},
+		{
+			0x0000, 0xC051, 0xC0A1, 0x00F0, 0xC141, 0x0110, 0x01E0, 0xC1B1,
+			0xC281, 0x02D0, 0x0220, 0xC271, 0x03C0, 0xC391, 0xC361, 0x0330,
+			0xC501, 0x0550, 0x05A0, 0xC5F1, 0x0440, 0xC411, 0xC4E1, 0x04B0,
+			0x0780, 0xC7D1, 0xC721, 0x0770, 0xC6C1, 0x0690, 0x0660, 0xC631,
+			0xCA01, 0x0A50, 0x0AA0, 0xCAF1, 0x0B40, 0xCB11, 0xCBE1, 0x0BB0,
+			0x0880, 0xC8D1, 0xC821, 0x0870, 0xC9C1, 0x0990, 0x0960, 0xC931,
+			0x0F00, 0xCF51, 0xCFA1, 0x0FF0, 0xCE41, 0x0E10, 0x0EE0, 0xCEB1,
+			0xCD81, 0x0DD0, 0x0D20, 0xCD71, 0x0CC0, 0xCC91, 0xCC61, 0x0C30,
+			0xD401, 0x1450, 0x14A0, 0xD4F1, 0x1540, 0xD511, 0xD5E1, 0x15B0,
+			0x1680, 0xD6D1, 0xD621, 0x1670, 0xD7C1, 0x1790, 0x1760, 0xD731,
+			0x1100, 0xD151, 0xD1A1, 0x11F0, 0xD041, 0x1010, 0x10E0, 0xD0B1,
+			0xD381, 0x13D0, 0x1320, 0xD371, 0x12C0, 0xD291, 0xD261, 0x1230,
+			0x1E00, 0xDE51, 0xDEA1, 0x1EF0, 0xDF41, 0x1F10, 0x1FE0, 0xDFB1,
+			0xDC81, 0x1CD0, 0x1C20, 0xDC71, 0x1DC0, 0xDD91, 0xDD61, 0x1D30,
+			0xDB01, 0x1B50, 0x1BA0, 0xDBF1, 0x1A40, 0xDA11, 0xDAE1, 0x1AB0,
+			0x1980, 0xD9D1, 0xD921, 0x1970, 0xD8C1, 0x1890, 0x1860, 0xD831,
+			0xE801, 0x2850, 0x28A0, 0xE8F1, 0x2940, 0xE911, 0xE9E1, 0x29B0,
+			0x2A80, 0xEAD1, 0xEA21, 0x2A70, 0xEBC1, 0x2B90, 0x2B60, 0xEB31,
+			0x2D00, 0xED51, 0xEDA1, 0x2DF0, 0xEC41, 0x2C10, 0x2CE0, 0xECB1,
+			0xEF81, 0x2FD0, 0x2F20, 0xEF71, 0x2EC0, 0xEE91, 0xEE61, 0x2E30,
+			0x2200, 0xE251, 0xE2A1, 0x22F0, 0xE341, 0x2310, 0x23E0, 0xE3B1,
+			0xE081, 0x20D0, 0x2020, 0xE071, 0x21C0, 0xE191, 0xE161, 0x2130,
+			0xE701, 0x2750, 0x27A0, 0xE7F1, 0x2640, 0xE611, 0xE6E1, 0x26B0,
+			0x2580, 0xE5D1, 0xE521, 0x2570, 0xE4C1, 0x2490, 0x2460, 0xE431,
+			0x3C00, 0xFC51, 0xFCA1, 0x3CF0, 0xFD41, 0x3D10, 0x3DE0, 0xFDB1,
+			0xFE81, 0x3ED0, 0x3E20, 0xFE71, 0x3FC0, 0xFF91, 0xFF61, 0x3F30,
+			0xF901, 0x3950, 0x39A0, 0xF9F1, 0x3840, 0xF811, 0xF8E1, 0x38B0,
+			0x3B80, 0xFBD1, 0xFB21, 0x3B70, 0xFAC1, 0x3A90, 0x3A60, 0xFA31,
+			0xF601, 0x3650, 0x36A0, 0xF6F1, 0x3740, 0xF711, 0xF7E1, 0x37B0,
+			0x3480, 0xF4D1, 0xF421, 0x3470, 0xF5C1, 0x3590, 0x3560, 0xF531,
+			0x3300, 0xF351, 0xF3A1, 0x33F0, 0xF241, 0x3210, 0x32E0, 0xF2B1,
+			0xF181, 0x31D0, 0x3120, 0xF171, 0x30C0, 0xF091, 0xF061, 0x3030
+		},
+		{
+			0x0000, 0xFC01, 0xB801, 0x4400, 0x3001, 0xCC00, 0x8800, 0x7401,
+			0x6002, 0x9C03, 0xD803, 0x2402, 0x5003, 0xAC02, 0xE802, 0x1403,
+			0xC004, 0x3C05, 0x7805, 0x8404, 0xF005, 0x0C04, 0x4804, 0xB405,
+			0xA006, 0x5C07, 0x1807, 0xE406, 0x9007, 0x6C06, 0x2806, 0xD407,
+			0xC00B, 0x3C0A, 0x780A, 0x840B, 0xF00A, 0x0C0B, 0x480B, 0xB40A,
+			0xA009, 0x5C08, 0x1808, 0xE409, 0x9008, 0x6C09, 0x2809, 0xD408,
+			0x000F, 0xFC0E, 0xB80E, 0x440F, 0x300E, 0xCC0F, 0x880F, 0x740E,
+			0x600D, 0x9C0C, 0xD80C, 0x240D, 0x500C, 0xAC0D, 0xE80D, 0x140C,
+			0xC015, 0x3C14, 0x7814, 0x8415, 0xF014, 0x0C15, 0x4815, 0xB414,
+			0xA017, 0x5C16, 0x1816, 0xE417, 0x9016, 0x6C17, 0x2817, 0xD416,
+			0x0011, 0xFC10, 0xB810, 0x4411, 0x3010, 0xCC11, 0x8811, 0x7410,
+			0x6013, 0x9C12, 0xD812, 0x2413, 0x5012, 0xAC13, 0xE813, 0x1412,
+			0x001E, 0xFC1F, 0xB81F, 0x441E, 0x301F, 0xCC1E, 0x881E, 0x741F,
+			0x601C, 0x9C1D, 0xD81D, 0x241C, 0x501D, 0xAC1C, 0xE81C, 0x141D,
+			0xC01A, 0x3C1B, 0x781B, 0x841A, 0xF01B, 0x0C1A, 0x481A, 0xB41B,
+			0xA018, 0x5C19, 0x1819, 0xE418, 0x9019, 0x6C18, 0x2818, 0xD419,
+			0xC029, 0x3C28, 0x7828, 0x8429, 0xF028, 0x0C29, 0x4829, 0xB428,
+			0xA02B, 0x5C2A, 0x182A, 0xE42B, 0x902A, 0x6C2B, 0x282B, 0xD42A,
+			0x002D, 0xFC2C, 0xB82C, 0x442D, 0x302C, 0xCC2D, 0x882D, 0x742C,
+			0x602F, 0x9C2E, 0xD82E, 0x242F, 0x502E, 0xAC2F, 0xE82F, 0x142E,
+			0x0022, 0xFC23, 0xB823, 0x4422, 0x3023, 0xCC22, 0x8822, 0x7423,
+			0x6020, 0x9C21, 0xD821, 0x2420, 0x5021, 0xAC20, 0xE820, 0x1421,
+			0xC026, 0x3C27, 0x7827, 0x8426, 0xF027, 0x0C26, 0x4826, 0xB427,
+			0xA024, 0x5C25, 0x1825, 0xE424, 0x9025, 0x6C24, 0x2824, 0xD425,
+			0x003C, 0xFC3D, 0xB83D, 0x443C, 0x303D, 0xCC3C, 0x883C, 0x743D,
+			0x603E, 0x9C3F, 0xD83F, 0x243E, 0x503F, 0xAC3E, 0xE83E, 0x143F,
+			0xC038, 0x3C39, 0x7839, 0x8438, 0xF039, 0x0C38, 0x4838, 0xB439,
+			0xA03A, 0x5C3B, 0x183B, 0xE43A, 0x903B, 0x6C3A, 0x283A, 0xD43B,
+			0xC037, 0x3C36, 0x7836, 0x8437, 0xF036, 0x0C37, 0x4837, 0xB436,
+			0xA035, 0x5C34, 0x1834, 0xE435, 0x9034, 0x6C35, 0x2835, 0xD434,
+			0x0033, 0xFC32, 0xB832, 0x4433, 0x3032, 0xCC33, 0x8833, 0x7432,
+			0x6031, 0x9C30, 0xD830, 0x2431, 0x5030, 0xAC31, 0xE831, 0x1430
+		},
+		{
+			0x0000, 0xC03D, 0xC079, 0x0044, 0xC0F1, 0x00CC, 0x0088, 0xC0B5,
+			0xC1E1, 0x01DC, 0x0198, 0xC1A5, 0x0110, 0xC12D, 0xC169, 0x0154,
+			0xC3C1, 0x03FC, 0x03B8, 0xC385, 0x0330, 0xC30D, 0xC349, 0x0374,
+			0x0220, 0xC21D, 0xC259, 0x0264, 0xC2D1, 0x02EC, 0x02A8, 0xC295,
+			0xC781, 0x07BC, 0x07F8, 0xC7C5, 0x0770, 0xC74D, 0xC709, 0x0734,
+			0x0660, 0xC65D, 0xC619, 0x0624, 0xC691, 0x06AC, 0x06E8, 0xC6D5,
+			0x0440, 0xC47D, 0xC439, 0x0404, 0xC4B1, 0x048C, 0x04C8, 0xC4F5,
+			0xC5A1, 0x059C, 0x05D8, 0xC5E5, 0x0550, 0xC56D, 0xC529, 0x0514,
+			0xCF01, 0x0F3C, 0x0F78, 0xCF45, 0x0FF0, 0xCFCD, 0xCF89, 0x0FB4,
+			0x0EE0, 0xCEDD, 0xCE99, 0x0EA4, 0xCE11, 0x0E2C, 0x0E68, 0xCE55,
+			0x0CC0, 0xCCFD, 0xCCB9, 0x0C84, 0xCC31, 0x0C0C, 0x0C48, 0xCC75,
+			0xCD21, 0x0D1C, 0x0D58, 0xCD65, 0x0DD0, 0xCDED, 0xCDA9, 0x0D94,
+			0x0880, 0xC8BD, 0xC8F9, 0x08C4, 0xC871, 0x084C, 0x0808, 0xC835,
+			0xC961, 0x095C, 0x0918, 0xC925, 0x0990, 0xC9AD, 0xC9E9, 0x09D4,
+			0xCB41, 0x0B7C, 0x0B38, 0xCB05, 0x0BB0, 0xCB8D, 0xCBC9, 0x0BF4,
+			0x0AA0, 0xCA9D, 0xCAD9, 0x0AE4, 0xCA51, 0x0A6C, 0x0A28, 0xCA15,
+			0xDE01, 0x1E3C, 0x1E78, 0xDE45, 0x1EF0, 0xDECD, 0xDE89, 0x1EB4,
+			0x1FE0, 0xDFDD, 0xDF99, 0x1FA4, 0xDF11, 0x1F2C, 0x1F68, 0xDF55,
+			0x1DC0, 0xDDFD, 0xDDB9, 0x1D84, 0xDD31, 0x1D0C, 0x1D48, 0xDD75,
+			0xDC21, 0x1C1C, 0x1C58, 0xDC65, 0x1CD0, 0xDCED, 0xDCA9, 0x1C94,
+			0x1980, 0xD9BD, 0xD9F9, 0x19C4, 0xD971, 0x194C, 0x1908, 0xD935,
+			0xD861, 0x185C, 0x1818, 0xD825, 0x1890, 0xD8AD, 0xD8E9, 0x18D4,
+			0xDA41, 0x1A7C, 0x1A38, 0xDA05, 0x1AB0, 0xDA8D, 0xDAC9, 0x1AF4,
+			0x1BA0, 0xDB9D, 0xDBD9, 0x1BE4, 0xDB51, 0x1B6C, 0x1B28, 0xDB15,
+			0x1100, 0xD13D, 0xD179, 0x1144, 0xD1F1, 0x11CC, 0x1188, 0xD1B5,
+			0xD0E1, 0x10DC, 0x1098, 0xD0A5, 0x1010, 0xD02D, 0xD069, 0x1054,
+			0xD2C1, 0x12FC, 0x12B8, 0xD285, 0x1230, 0xD20D, 0xD249, 0x1274,
+			0x1320, 0xD31D, 0xD359, 0x1364, 0xD3D1, 0x13EC, 0x13A8, 0xD395,
+			0xD681, 0x16BC, 0x16F8, 0xD6C5, 0x1670, 0xD64D, 0xD609, 0x1634,
+			0x1760, 0xD75D, 0xD719, 0x1724, 0xD791, 0x17AC, 0x17E8, 0xD7D5,
+			0x1540, 0xD57D, 0xD539, 0x1504, 0xD5B1, 0x158C, 0x15C8, 0xD5F5,
+			0xD4A1, 0x149C, 0x14D8, 0xD4E5, 0x1450, 0xD46D, 0xD429, 0x1414
+		},
+		{
+			0x0000, 0xD101, 0xE201, 0x3300, 0x8401, 0x5500, 0x6600, 0xB701,
+			0x4801, 0x9900, 0xAA00, 0x7B01, 0xCC00, 0x1D01, 0x2E01, 0xFF00,
+			0x9002, 0x4103, 0x7203, 0xA302, 0x1403, 0xC502, 0xF602, 0x2703,
+			0xD803, 0x0902, 0x3A02, 0xEB03, 0x5C02, 0x8D03, 0xBE03, 0x6F02,
+			0x6007, 0xB106, 0x8206, 0x5307, 0xE406, 0x3507, 0x0607, 0xD706,
+			0x2806, 0xF907, 0xCA07, 0x1B06, 0xAC07, 0x7D06, 0x4E06, 0x9F07,
+			0xF005, 0x2104, 0x1204, 0xC305, 0x7404, 0xA505, 0x9605, 0x4704,
+			0xB804, 0x6905, 0x5A05, 0x8B04, 0x3C05, 0xED04, 0xDE04, 0x0F05,
+			0xC00E, 0x110F, 0x220F, 0xF30E, 0x440F, 0x950E, 0xA60E, 0x770F,
+			0x880F, 0x590E, 0x6A0E, 0xBB0F, 0x0C0E, 0xDD0F, 0xEE0F, 0x3F0E,
+			0x500C, 0x810D, 0xB20D, 0x630C, 0xD40D, 0x050C, 0x360C, 0xE70D,
+			0x180D, 0xC90C, 0xFA0C, 0x2B0D, 0x9C0C, 0x4D0D, 0x7E0D, 0xAF0C,
+			0xA009, 0x7108, 0x4208, 0x9309, 0x2408, 0xF509, 0xC609, 0x1708,
+			0xE808, 0x3909, 0x0A09, 0xDB08, 0x6C09, 0xBD08, 0x8E08, 0x5F09,
+			0x300B, 0xE10A, 0xD20A, 0x030B, 0xB40A, 0x650B, 0x560B, 0x870A,
+			0x780A, 0xA90B, 0x9A0B, 0x4B0A, 0xFC0B, 0x2D0A, 0x1E0A, 0xCF0B,
+			0xC01F, 0x111E, 0x221E, 0xF31F, 0x441E, 0x951F, 0xA61F, 0x771E,
+			0x881E, 0x591F, 0x6A1F, 0xBB1E, 0x0C1F, 0xDD1E, 0xEE1E, 0x3F1F,
+			0x501D, 0x811C, 0xB21C, 0x631D, 0xD41C, 0x051D, 0x361D, 0xE71C,
+			0x181C, 0xC91D, 0xFA1D, 0x2B1C, 0x9C1D, 0x4D1C, 0x7E1C, 0xAF1D,
+			0xA018, 0x7119, 0x4219, 0x9318, 0x2419, 0xF518, 0xC618, 0x1719,
+			0xE819, 0x3918, 0x0A18, 0xDB19, 0x6C18, 0xBD19, 0x8E19, 0x5F18,
+			0x301A, 0xE11B, 0xD21B, 0x031A, 0xB41B, 0x651A, 0x561A, 0x871B,
+			0x781B, 0xA91A, 0x9A1A, 0x4B1B, 0xFC1A, 0x2D1B, 0x1E1B, 0xCF1A,
+			0x0011, 0xD110, 0xE210, 0x3311, 0x8410, 0x5511, 0x6611, 0xB710,
+			0x4810, 0x9911, 0xAA11, 0x7B10, 0xCC11, 0x1D10, 0x2E10, 0xFF11,
+			0x9013, 0x4112, 0x7212, 0xA313, 0x1412, 0xC513, 0xF613, 0x2712,
+			0xD812, 0x0913, 0x3A13, 0xEB12, 0x5C13, 0x8D12, 0xBE12, 0x6F13,
+			0x6016, 0xB117, 0x8217, 0x5316, 0xE417, 0x3516, 0x0616, 0xD717,
+			0x2817, 0xF916, 0xCA16, 0x1B17, 0xAC16, 0x7D17, 0x4E17, 0x9F16,
+			0xF014, 0x2115, 0x1215, 0xC314, 0x7415, 0xA514, 0x9614, 0x4715,
+			0xB815, 0x6914, 0x5A14, 0x8B15, 0x3C14, 0xED15, 0xDE15, 0x0F14
+		},
+		{
+			0x0000, 0xC010, 0xC023, 0x0033, 0xC045, 0x0055, 0x0066, 0xC076,
+			0xC089, 0x0099, 0x00AA, 0xC0BA, 0x00CC, 0xC0DC, 0xC0EF, 0x00FF,
+			0xC111, 0x0101, 0x0132, 0xC122, 0x0154, 0xC144, 0xC177, 0x0167,
+			0x0198, 0xC188, 0xC1BB, 0x01AB, 0xC1DD, 0x01CD, 0x01FE, 0xC1EE,
+			0xC221, 0x0231, 0x0202, 0xC212, 0x0264, 0xC274, 0xC247, 0x0257,
+			0x02A8, 0xC2B8, 0xC28B, 0x029B, 0xC2ED, 0x02FD, 0x02CE, 0xC2DE,
+			0x0330, 0xC320, 0xC313, 0x0303, 0xC375, 0x0365, 0x0356, 0xC346,
+			0xC3B9, 0x03A9, 0x039A, 0xC38A, 0x03FC, 0xC3EC, 0xC3DF, 0x03CF,
+			0xC441, 0x0451, 0x0462, 0xC472, 0x0404, 0xC414, 0xC427, 0x0437,
+			0x04C8, 0xC4D8, 0xC4EB, 0x04FB, 0xC48D, 0x049D, 0x04AE, 0xC4BE,
+			0x0550, 0xC540, 0xC573, 0x0563, 0xC515, 0x0505, 0x0536, 0xC526,
+			0xC5D9, 0x05C9, 0x05FA, 0xC5EA, 0x059C, 0xC58C, 0xC5BF, 0x05AF,
+			0x0660, 0xC670, 0xC643, 0x0653, 0xC625, 0x0635, 0x0606, 0xC616,
+			0xC6E9, 0x06F9, 0x06CA, 0xC6DA, 0x06AC, 0xC6BC, 0xC68F, 0x069F,
+			0xC771, 0x0761, 0x0752, 0xC742, 0x0734, 0xC724, 0xC717, 0x0707,
+			0x07F8, 0xC7E8, 0xC7DB, 0x07CB, 0xC7BD, 0x07AD, 0x079E, 0xC78E,
+			0xC881, 0x0891, 0x08A2, 0xC8B2, 0x08C4, 0xC8D4, 0xC8E7, 0x08F7,
+			0x0808, 0xC818, 0xC82B, 0x083B, 0xC84D, 0x085D, 0x086E, 0xC87E,
+			0x0990, 0xC980, 0xC9B3, 0x09A3, 0xC9D5, 0x09C5, 0x09F6, 0xC9E6,
+			0xC919, 0x0909, 0x093A, 0xC92A, 0x095C, 0xC94C, 0xC97F, 0x096F,
+			0x0AA0, 0xCAB0, 0xCA83, 0x0A93, 0xCAE5, 0x0AF5, 0x0AC6, 0xCAD6,
+			0xCA29, 0x0A39, 0x0A0A, 0xCA1A, 0x0A6C, 0xCA7C, 0xCA4F, 0x0A5F,
+			0xCBB1, 0x0BA1, 0x0B92, 0xCB82, 0x0BF4, 0xCBE4, 0xCBD7, 0x0BC7,
+			0x0B38, 0xCB28, 0xCB1B, 0x0B0B, 0xCB7D, 0x0B6D, 0x0B5E, 0xCB4E,
+			0x0CC0, 0xCCD0, 0xCCE3, 0x0CF3, 0xCC85, 0x0C95, 0x0CA6, 0xCCB6,
+			0xCC49, 0x0C59, 0x0C6A, 0xCC7A, 0x0C0C, 0xCC1C, 0xCC2F, 0x0C3F,
+			0xCDD1, 0x0DC1, 0x0DF2, 0xCDE2, 0x0D94, 0xCD84, 0xCDB7, 0x0DA7,
+			0x0D58, 0xCD48, 0xCD7B, 0x0D6B, 0xCD1D, 0x0D0D, 0x0D3E, 0xCD2E,
+			0xCEE1, 0x0EF1, 0x0EC2, 0xCED2, 0x0EA4, 0xCEB4, 0xCE87, 0x0E97,
+			0x0E68, 0xCE78, 0xCE4B, 0x0E5B, 0xCE2D, 0x0E3D, 0x0E0E, 0xCE1E,
+			0x0FF0, 0xCFE0, 0xCFD3, 0x0FC3, 0xCFB5, 0x0FA5, 0x0F96, 0xCF86,
+			0xCF79, 0x0F69, 0x0F5A, 0xCF4A, 0x0F3C, 0xCF2C, 0xCF1F, 0x0F0F
+		},
+		{
+			0x0000, 0xCCC1, 0xD981, 0x1540, 0xF301, 0x3FC0, 0x2A80, 0xE641,
+			0xA601, 0x6AC0, 0x7F80, 0xB341, 0x5500, 0x99C1, 0x8C81, 0x4040,
+			0x0C01, 0xC0C0, 0xD580, 0x1941, 0xFF00, 0x33C1, 0x2681, 0xEA40,
+			0xAA00, 0x66C1, 0x7381, 0xBF40, 0x5901, 0x95C0, 0x8080, 0x4C41,
+			0x1802, 0xD4C3, 0xC183, 0x0D42, 0xEB03, 0x27C2, 0x3282, 0xFE43,
+			0xBE03, 0x72C2, 0x6782, 0xAB43, 0x4D02, 0x81C3, 0x9483, 0x5842,
+			0x1403, 0xD8C2, 0xCD82, 0x0143, 0xE702, 0x2BC3, 0x3E83, 0xF242,
+			0xB202, 0x7EC3, 0x6B83, 0xA742, 0x4103, 0x8DC2, 0x9882, 0x5443,
+			0x3004, 0xFCC5, 0xE985, 0x2544, 0xC305, 0x0FC4, 0x1A84, 0xD645,
+			0x9605, 0x5AC4, 0x4F84, 0x8345, 0x6504, 0xA9C5, 0xBC85, 0x7044,
+			0x3C05, 0xF0C4, 0xE584, 0x2945, 0xCF04, 0x03C5, 0x1685, 0xDA44,
+			0x9A04, 0x56C5, 0x4385, 0x8F44, 0x6905, 0xA5C4, 0xB084, 0x7C45,
+			0x2806, 0xE4C7, 0xF187, 0x3D46, 0xDB07, 0x17C6, 0x0286, 0xCE47,
+			0x8E07, 0x42C6, 0x5786, 0x9B47, 0x7D06, 0xB1C7, 0xA487, 0x6846,
+			0x2407, 0xE8C6, 0xFD86, 0x3147, 0xD706, 0x1BC7, 0x0E87, 0xC246,
+			0x8206, 0x4EC7, 0x5B87, 0x9746, 0x7107, 0xBDC6, 0xA886, 0x6447,
+			0x6008, 0xACC9, 0xB989, 0x7548, 0x9309, 0x5FC8, 0x4A88, 0x8649,
+			0xC609, 0x0AC8, 0x1F88, 0xD349, 0x3508, 0xF9C9, 0xEC89, 0x2048,
+			0x6C09, 0xA0C8, 0xB588, 0x7949, 0x9F08, 0x53C9, 0x4689, 0x8A48,
+			0xCA08, 0x06C9, 0x1389, 0xDF48, 0x3909, 0xF5C8, 0xE088, 0x2C49,
+			0x780A, 0xB4CB, 0xA18B, 0x6D4A, 0x8B0B, 0x47CA, 0x528A, 0x9E4B,
+			0xDE0B, 0x12CA, 0x078A, 0xCB4B, 0x2D0A, 0xE1CB, 0xF48B, 0x384A,
+			0x740B, 0xB8CA, 0xAD8A, 0x614B, 0x870A, 0x4BCB, 0x5E8B, 0x924A,
+			0xD20A, 0x1ECB, 0x0B8B, 0xC74A, 0x210B, 0xEDCA, 0xF88A, 0x344B,
+			0x500C, 0x9CCD, 0x898D, 0x454C, 0xA30D, 0x6FCC, 0x7A8C, 0xB64D,
+			0xF60D, 0x3ACC, 0x2F8C, 0xE34D, 0x050C, 0xC9CD, 0xDC8D, 0x104C,
+			0x5C0D, 0x90CC, 0x858C, 0x494D, 0xAF0C, 0x63CD, 0x768D, 0xBA4C,
+			0xFA0C, 0x36CD, 0x238D, 0xEF4C, 0x090D, 0xC5CC, 0xD08C, 0x1C4D,
+			0x480E, 0x84CF, 0x918F, 0x5D4E, 0xBB0F, 0x77CE, 0x628E, 0xAE4F,
+			0xEE0F, 0x22CE, 0x378E, 0xFB4F, 0x1D0E, 0xD1CF, 0xC48F, 0x084E,
+			0x440F, 0x88CE, 0x9D8E, 0x514F, 0xB70E, 0x7BCF, 0x6E8F, 0xA24E,
+			0xE20E, 0x2ECF, 0x3B8F, 0xF74E, 0x110F, 0xDDCE, 0xC88E, 0x044F
+		},
+#if TP_CRC16_ENGINE >= TP_CRC_SLICING_16
+		{
+			0x0000, 0x900D, 0x6019, 0xF014, 0xC032, 0x503F, 0xA02B, 0x3026,
+			0xC067, 0x506A, 0xA07E, 0x3073, 0x0055, 0x9058, 0x604C, 0xF041,
+			0xC0CD, 0x50C0, 0xA0D4, 0x30D9, 0x00FF, 0x90F2, 0x60E6, 0xF0EB,
+			0x00AA, 0x90A7, 0x60B3, 0xF0BE, 0xC098, 0x5095, 0xA081, 0x308C,
+			0xC199, 0x5194, 0xA180, 0x318D, 0x01AB, 0x91A6, 0x61B2, 0xF1BF,
+			0x01FE, 0x91F3, 0x61E7, 0xF1EA, 0xC1CC, 0x51C1, 0xA1D5, 0x31D8,
+			0x0154, 0x9159, 0x614D, 0xF140, 0xC166, 0x516B, 0xA17F, 0x3172,
+			0xC133, 0x513E, 0xA12A, 0x3127, 0x0101, 0x910C, 0x6118, 0xF115,
+			0xC331, 0x533C, 0xA328, 0x3325, 0x0303, 0x930E, 0x631A, 0xF317,
+			0x0356, 0x935B, 0x634F, 0xF342, 0xC364, 0x5369, 0xA37D, 0x3370,
+			0x03FC, 0x93F1, 0x63E5, 0xF3E8, 0xC3CE, 0x53C3, 0xA3D7, 0x33DA,
+			0xC39B, 0x5396, 0xA382, 0x338F, 0x03A9, 0x93A4, 0x63B0, 0xF3BD,
+			0x02A8, 0x92A5, 0x62B1, 0xF2BC, 0xC29A, 0x5297, 0xA283, 0x328E,
+			0xC2CF, 0x52C2, 0xA2D6, 0x32DB, 0x02FD, 0x92F0, 0x62E4, 0xF2E9,
+			0xC265, 0x5268, 0xA27C, 0x3271, 0x0257, 0x925A, 0x624E, 0xF243,
+			0x0202, 0x920F, 0x621B, 0xF216, 0xC230, 0x523D, 0xA229, 0x3224,
+			0xC661, 0x566C, 0xA678, 0x3675, 0x0653, 0x965E, 0x664A, 0xF647,
+			0x0606, 0x960B, 0x661F, 0xF612, 0xC634, 0x5639, 0xA62D, 0x3620,
+			0x06AC, 0x96A1, 0x66B5, 0xF6B8, 0xC69E, 0x5693, 0xA687, 0x368A,
+			0xC6CB, 0x56C6, 0xA6D2, 0x36DF, 0x06F9, 0x96F4, 0x66E0, 0xF6ED,
+			0x07F8, 0x97F5, 0x67E1, 0xF7EC, 0xC7CA, 0x57C7, 0xA7D3, 0x37DE,
+			0xC79F, 0x5792, 0xA786, 0x378B, 0x07AD, 0x97A0, 0x67B4, 0xF7B9,
+			0xC735, 0x5738, 0xA72C, 0x3721, 0x0707, 0x970A, 0x671E, 0xF713,
+			0x0752, 0x975F, 0x674B, 0xF746, 0xC760, 0x576D, 0xA779, 0x3774,
+			0x0550, 0x955D, 0x6549, 0xF544, 0xC562, 0x556F, 0xA57B, 0x3576,
+			0xC537, 0x553A, 0xA52E, 0x3523, 0x0505, 0x9508, 0x651C, 0xF511,
+			0xC59D, 0x5590, 0xA584, 0x3589, 0x05AF, 0x95A2, 0x65B6, 0xF5BB,
+			0x05FA, 0x95F7, 0x65E3, 0xF5EE, 0xC5C8, 0x55C5, 0xA5D1, 0x35DC,
+			0xC4C9, 0x54C4, 0xA4D0, 0x34DD, 0x04FB, 0x94F6, 0x64E2, 0xF4EF,
+			0x04AE, 0x94A3, 0x64B7, 0xF4BA, 0xC49C, 0x5491, 0xA485, 0x3488,
+			0x0404, 0x9409, 0x641D, 0xF410, 0xC436, 0x543B, 0xA42F, 0x3422,
+			0xC463, 0x546E, 0xA47A, 0x3477, 0x0451, 0x945C, 0x6448, 0xF445
+		},
+		{
+			0x0000, 0xC551, 0xCAA1, 0x0FF0, 0xD541, 0x1010, 0x1FE0, 0xDAB1,
+			0xEA81, 0x2FD0, 0x2020, 0xE571, 0x3FC0, 0xFA91, 0xF561, 0x3030,
+			0x9501, 0x5050, 0x5FA0, 0x9AF1, 0x4040, 0x8511, 0x8AE1, 0x4FB0,
+			0x7F80, 0xBAD1, 0xB521, 0x7070, 0xAAC1, 0x6F90, 0x6060, 0xA531,
+			0x6A01, 0xAF50, 0xA0A0, 0x65F1, 0xBF40, 0x7A11, 0x75E1, 0xB0B0,
+			0x8080, 0x45D1, 0x4A21, 0x8F70, 0x55C1, 0x9090, 0x9F60, 0x5A31,
+			0xFF00, 0x3A51, 0x35A1, 0xF0F0, 0x2A41, 0xEF10, 0xE0E0, 0x25B1,
+			0x1581, 0xD0D0, 0xDF20, 0x1A71, 0xC0C0, 0x0591, 0x0A61, 0xCF30,
+			0xD402, 0x1153, 0x1EA3, 0xDBF2, 0x0143, 0xC412, 0xCBE2, 0x0EB3,
+			0x3E83, 0xFBD2, 0xF422, 0x3173, 0xEBC2, 0x2E93, 0x2163, 0xE432,
+			0x4103, 0x8452, 0x8BA2, 0x4EF3, 0x9442, 0x5113, 0x5EE3, 0x9BB2,
+			0xAB82, 0x6ED3, 0x6123, 0xA472, 0x7EC3, 0xBB92, 0xB462, 0x7133,
+			0xBE03, 0x7B52, 0x74A2, 0xB1F3, 0x6B42, 0xAE13, 0xA1E3, 0x64B2,
+			0x5482, 0x91D3, 0x9E23, 0x5B72, 0x81C3, 0x4492, 0x4B62, 0x8E33,
+			0x2B02, 0xEE53, 0xE1A3, 0x24F2, 0xFE43, 0x3B12, 0x34E2, 0xF1B3,
+			0xC183, 0x04D2, 0x0B22, 0xCE73, 0x14C2, 0xD193, 0xDE63, 0x1B32,
+			0xE807, 0x2D56, 0x22A6, 0xE7F7, 0x3D46, 0xF817, 0xF7E7, 0x32B6,
+			0x0286, 0xC7D7, 0xC827, 0x0D76, 0xD7C7, 0x1296, 0x1D66, 0xD837,
+			0x7D06, 0xB857, 0xB7A7, 0x72F6, 0xA847, 0x6D16, 0x62E6, 0xA7B7,
+			0x9787, 0x52D6, 0x5D26, 0x9877, 0x42C6, 0x8797, 0x8867, 0x4D36,
+			0x8206, 0x4757, 0x48A7, 0x8DF6, 0x5747, 0x9216, 0x9DE6, 0x58B7,
+			0x6887, 0xADD6, 0xA226, 0x6777, 0xBDC6, 0x7897, 0x7767, 0xB236,
+			0x1707, 0xD256, 0xDDA6, 0x18F7, 0xC246, 0x0717, 0x08E7, 0xCDB6,
+			0xFD86, 0x38D7, 0x3727, 0xF276, 0x28C7, 0xED96, 0xE266, 0x2737,
+			0x3C05, 0xF954, 0xF6A4, 0x33F5, 0xE944, 0x2C15, 0x23E5, 0xE6B4,
+			0xD684, 0x13D5, 0x1C25, 0xD974, 0x03C5, 0xC694, 0xC964, 0x0C35,
+			0xA904, 0x6C55, 0x63A5, 0xA6F4, 0x7C45, 0xB914, 0xB6E4, 0x73B5,
+			0x4385, 0x86D4, 0x8924, 0x4C75, 0x96C4, 0x5395, 0x5C65, 0x9934,
+			0x5604, 0x9355, 0x9CA5, 0x59F4, 0x8345, 0x4614, 0x49E4, 0x8CB5,
+			0xBC85, 0x79D4, 0x7624, 0xB375, 0x69C4, 0xAC95, 0xA365, 0x6634,
+			0xC305, 0x0654, 0x09A4, 0xCCF5, 0x1644, 0xD315, 0xDCE5, 0x19B4,
+			0x2984, 0xECD5, 0xE325, 0x2674, 0xFCC5, 0x3994, 0x3664, 0xF335
+		},
+		{
+			0x0000, 0xFC04, 0xB80B, 0x440F, 0x3015, 0xCC11, 0x881E, 0x741A,
+			0x602A, 0x9C2E, 0xD821, 0x2425, 0x503F, 0xAC3B, 0xE834, 0x1430,
+			0xC054, 0x3C50, 0x785F, 0x845B, 0xF041, 0x0C45, 0x484A, 0xB44E,
+			0xA07E, 0x5C7A, 0x1875, 0xE471, 0x906B, 0x6C6F, 0x2860, 0xD464,
+			0xC0AB, 0x3CAF, 0x78A0, 0x84A4, 0xF0BE, 0x0CBA, 0x48B5, 0xB4B1,
+			0xA081, 0x5C85, 0x188A, 0xE48E, 0x9094, 0x6C90, 0x289F, 0xD49B,
+			0x00FF, 0xFCFB, 0xB8F4, 0x44F0, 0x30EA, 0xCCEE, 0x88E1, 0x74E5,
+			0x60D5, 0x9CD1, 0xD8DE, 0x24DA, 0x50C0, 0xACC4, 0xE8CB, 0x14CF,
+			0xC155, 0x3D51, 0x795E, 0x855A, 0xF140, 0x0D44, 0x494B, 0xB54F,
+			0xA17F, 0x5D7B, 0x1974, 0xE570, 0x916A, 0x6D6E, 0x2961, 0xD565,
+			0x0101, 0xFD05, 0xB90A, 0x450E, 0x3114, 0xCD10, 0x891F, 0x751B,
+			0x612B, 0x9D2F, 0xD920, 0x2524, 0x513E, 0xAD3A, 0xE935, 0x1531,
+			0x01FE, 0xFDFA, 0xB9F5, 0x45F1, 0x31EB, 0xCDEF, 0x89E0, 0x75E4,
+			0x61D4, 0x9DD0, 0xD9DF, 0x25DB, 0x51C1, 0xADC5, 0xE9CA, 0x15CE,
+			0xC1AA, 0x3DAE, 0x79A1, 0x85A5, 0xF1BF, 0x0DBB, 0x49B4, 0xB5B0,
+			0xA180, 0x5D84, 0x198B, 0xE58F, 0x9195, 0x6D91, 0x299E, 0xD59A,
+			0xC2A9, 0x3EAD, 0x7AA2, 0x86A6, 0xF2BC, 0x0EB8, 0x4AB7, 0xB6B3,
+			0xA283, 0x5E87, 0x1A88, 0xE68C, 0x9296, 0x6E92, 0x2A9D, 0xD699,
+			0x02FD, 0xFEF9, 0xBAF6, 0x46F2, 0x32E8, 0xCEEC, 0x8AE3, 0x76E7,
+			0x62D7, 0x9ED3, 0xDADC, 0x26D8, 0x52C2, 0xAEC6, 0xEAC9, 0x16CD,
+			0x0202, 0xFE06, 0xBA09, 0x460D, 0x3217, 0xCE13, 0x8A1C, 0x7618,
+			0x6228, 0x9E2C, 0xDA23, 0x2627, 0x523D, 0xAE39, 0xEA36, 0x1632,
+			0xC256, 0x3E52, 0x7A5D, 0x8659, 0xF243, 0x0E47, 0x4A48, 0xB64C,
+			0xA27C, 0x5E78, 0x1A77, 0xE673, 0x9269, 0x6E6D, 0x2A62, 0xD666,
+			0x03FC, 0xFFF8, 0xBBF7, 0x47F3, 0x33E9, 0xCFED, 0x8BE2, 0x77E6,
+			0x63D6, 0x9FD2, 0xDBDD, 0x27D9, 0x53C3, 0xAFC7, 0xEBC8, 0x17CC,
+			0xC3A8, 0x3FAC, 0x7BA3, 0x87A7, 0xF3BD, 0x0FB9, 0x4BB6, 0xB7B2,
+			0xA382, 0x5F86, 0x1B89, 0xE78D, 0x9397, 0x6F93, 0x2B9C, 0xD798,
+			0xC357, 0x3F53, 0x7B5C, 0x8758, 0xF342, 0x0F46, 0x4B49, 0xB74D,
+			0xA37D, 0x5F79, 0x1B76, 0xE772, 0x9368, 0x6F6C, 0x2B63, 0xD767,
+			0x0303, 0xFF07, 0xBB08, 0x470C, 0x3316, 0xCF12, 0x8B1D, 0x7719,
+			0x6329, 0x9F2D, 0xDB22, 0x2726, 0x533C, 0xAF38, 0xEB37, 0x1733
+		},
+		{
+			0x0000, 0xC3FD, 0xC7F9, 0x0404, 0xCFF1, 0x0C0C, 0x0808, 0xCBF5,
+			0xDFE1, 0x1C1C, 0x1818, 0xDBE5, 0x1010, 0xD3ED, 0xD7E9, 0x1414,
+			0xFFC1, 0x3C3C, 0x3838, 0xFBC5, 0x3030, 0xF3CD, 0xF7C9, 0x3434,
+			0x2020, 0xE3DD, 0xE7D9, 0x2424, 0xEFD1, 0x2C2C, 0x2828, 0xEBD5,
+			0xBF81, 0x7C7C, 0x7878, 0xBB85, 0x7070, 0xB38D, 0xB789, 0x7474,
+			0x6060, 0xA39D, 0xA799, 0x6464, 0xAF91, 0x6C6C, 0x6868, 0xAB95,
+			0x4040, 0x83BD, 0x87B9, 0x4444, 0x8FB1, 0x4C4C, 0x4848, 0x8BB5,
+			0x9FA1, 0x5C5C, 0x5858, 0x9BA5, 0x5050, 0x93AD, 0x97A9, 0x5454,
+			0x3F01, 0xFCFC, 0xF8F8, 0x3B05, 0xF0F0, 0x330D, 0x3709, 0xF4F4,
+			0xE0E0, 0x231D, 0x2719, 0xE4E4, 0x2F11, 0xECEC, 0xE8E8, 0x2B15,
+			0xC0C0, 0x033D, 0x0739, 0xC4C4, 0x0F31, 0xCCCC, 0xC8C8, 0x0B35,
+			0x1F21, 0xDCDC, 0xD8D8, 0x1B25, 0xD0D0, 0x132D, 0x1729, 0xD4D4,
+			0x8080, 0x437D, 0x4779, 0x8484, 0x4F71, 0x8C8C, 0x8888, 0x4B75,
+			0x5F61, 0x9C9C, 0x9898, 0x5B65, 0x9090, 0x536D, 0x5769, 0x9494,
+			0x7F41, 0xBCBC, 0xB8B8, 0x7B45, 0xB0B0, 0x734D, 0x7749, 0xB4B4,
+			0xA0A0, 0x635D, 0x6759, 0xA4A4, 0x6F51, 0xACAC, 0xA8A8, 0x6B55,
+			0x7E02, 0xBDFF, 0xB9FB, 0x7A06, 0xB1F3, 0x720E, 0x760A, 0xB5F7,
+			0xA1E3, 0x621E, 0x661A, 0xA5E7, 0x6E12, 0xADEF, 0xA9EB, 0x6A16,
+			0x81C3, 0x423E, 0x463A, 0x85C7, 0x4E32, 0x8DCF, 0x89CB, 0x4A36,
+			0x5E22, 0x9DDF, 0x99DB, 0x5A26, 0x91D3, 0x522E, 0x562A, 0x95D7,
+			0xC183, 0x027E, 0x067A, 0xC587, 0x0E72, 0xCD8F, 0xC98B, 0x0A76,
+			0x1E62, 0xDD9F, 0xD99B, 0x1A66, 0xD193, 0x126E, 0x166A, 0xD597,
+			0x3E42, 0xFDBF, 0xF9BB, 0x3A46, 0xF1B3, 0x324E, 0x364A, 0xF5B7,
+			0xE1A3, 0x225E, 0x265A, 0xE5A7, 0x2E52, 0xEDAF, 0xE9AB, 0x2A56,
+			0x4103, 0x82FE, 0x86FA, 0x4507, 0x8EF2, 0x4D0F, 0x490B, 0x8AF6,
+			0x9EE2, 0x5D1F, 0x591B, 0x9AE6, 0x5113, 0x92EE, 0x96EA, 0x5517,
+			0xBEC2, 0x7D3F, 0x793B, 0xBAC6, 0x7133, 0xB2CE, 0xB6CA, 0x7537,
+			0x6123, 0xA2DE, 0xA6DA, 0x6527, 0xAED2, 0x6D2F, 0x692B, 0xAAD6,
+			0xFE82, 0x3D7F, 0x397B, 0xFA86, 0x3173, 0xF28E, 0xF68A, 0x3577,
+			0x2163, 0xE29E, 0xE69A, 0x2567, 0xEE92, 0x2D6F, 0x296B, 0xEA96,
+			0x0143, 0xC2BE, 0xC6BA, 0x0547, 0xCEB2, 0x0D4F, 0x094B, 0xCAB6,
+			0xDEA2, 0x1D5F, 0x195B, 0xDAA6, 0x1153, 0xD2AE, 0xD6AA, 0x1557
+		},
+		{
+			0x0000, 0x8102, 0x4207, 0xC305, 0x840E, 0x050C, 0xC609, 0x470B,
+			0x481F, 0xC91D, 0x0A18, 0x8B1A, 0xCC11, 0x4D13, 0x8E16, 0x0F14,
+			0x903E, 0x113C, 0xD239, 0x533B, 0x1430, 0x9532, 0x5637, 0xD735,
+			0xD821, 0x5923, 0x9A26, 0x1B24, 0x5C2F, 0xDD2D, 0x1E28, 0x9F2A,
+			0x607F, 0xE17D, 0x2278, 0xA37A, 0xE471, 0x6573, 0xA676, 0x2774,
+			0x2860, 0xA962, 0x6A67, 0xEB65, 0xAC6E, 0x2D6C, 0xEE69, 0x6F6B,
+			0xF041, 0x7143, 0xB246, 0x3344, 0x744F, 0xF54D, 0x3648, 0xB74A,
+			0xB85E, 0x395C, 0xFA59, 0x7B5B, 0x3C50, 0xBD52, 0x7E57, 0xFF55,
+			0xC0FE, 0x41FC, 0x82F9, 0x03FB, 0x44F0, 0xC5F2, 0x06F7, 0x87F5,
+			0x88E1, 0x09E3, 0xCAE6, 0x4BE4, 0x0CEF, 0x8DED, 0x4EE8, 0xCFEA,
+			0x50C0, 0xD1C2, 0x12C7, 0x93C5, 0xD4CE, 0x55CC, 0x96C9, 0x17CB,
+			0x18DF, 0x99DD, 0x5AD8, 0xDBDA, 0x9CD1, 0x1DD3, 0xDED6, 0x5FD4,
+			0xA081, 0x2183, 0xE286, 0x6384, 0x248F, 0xA58D, 0x6688, 0xE78A,
+			0xE89E, 0x699C, 0xAA99, 0x2B9B, 0x6C90, 0xED92, 0x2E97, 0xAF95,
+			0x30BF, 0xB1BD, 0x72B8, 0xF3BA, 0xB4B1, 0x35B3, 0xF6B6, 0x77B4,
+			0x78A0, 0xF9A2, 0x3AA7, 0xBBA5, 0xFCAE, 0x7DAC, 0xBEA9, 0x3FAB,
+			0xC1FF, 0x40FD, 0x83F8, 0x02FA, 0x45F1, 0xC4F3, 0x07F6, 0x86F4,
+			0x89E0, 0x08E2, 0xCBE7, 0x4AE5, 0x0DEE, 0x8CEC, 0x4FE9, 0xCEEB,
+			0x51C1, 0xD0C3, 0x13C6, 0x92C4, 0xD5CF, 0x54CD, 0x97C8, 0x16CA,
+			0x19DE, 0x98DC, 0x5BD9, 0xDADB, 0x9DD0, 0x1CD2, 0xDFD7, 0x5ED5,
+			0xA180, 0x2082, 0xE387, 0x6285, 0x258E, 0xA48C, 0x6789, 0xE68B,
+			0xE99F, 0x689D, 0xAB98, 0x2A9A, 0x6D91, 0xEC93, 0x2F96, 0xAE94,
+			0x31BE, 0xB0BC, 0x73B9, 0xF2BB, 0xB5B0, 0x34B2, 0xF7B7, 0x76B5,
+			0x79A1, 0xF8A3, 0x3BA6, 0xBAA4, 0xFDAF, 0x7CAD, 0xBFA8, 0x3EAA,
+			0x0101, 0x8003, 0x4306, 0xC204, 0x850F, 0x040D, 0xC708, 0x460A,
+			0x491E, 0xC81C, 0x0B19, 0x8A1B, 0xCD10, 0x4C12, 0x8F17, 0x0E15,
+			0x913F, 0x103D, 0xD338, 0x523A, 0x1531, 0x9433, 0x5736, 0xD634,
+			0xD920, 0x5822, 0x9B27, 0x1A25, 0x5D2E, 0xDC2C, 0x1F29, 0x9E2B,
+			0x617E, 0xE07C, 0x2379, 0xA27B, 0xE570, 0x6472, 0xA777, 0x2675,
+			0x2961, 0xA863, 0x6B66, 0xEA64, 0xAD6F, 0x2C6D, 0xEF68, 0x6E6A,
+			0xF140, 0x7042, 0xB347, 0x3245, 0x754E, 0xF44C, 0x3749, 0xB64B,
+			0xB95F, 0x385D, 0xFB58, 0x7A5A, 0x3D51, 0xBC53, 0x7F56, 0xFE54
+		},
+		{
+			0x0000, 0xC100, 0xC203, 0x0303, 0xC405, 0x0505, 0x0606, 0xC706,
+			0xC809, 0x0909, 0x0A0A, 0xCB0A, 0x0C0C, 0xCD0C, 0xCE0F, 0x0F0F,
+			0xD011, 0x1111, 0x1212, 0xD312, 0x1414, 0xD514, 0xD617, 0x1717,
+			0x1818, 0xD918, 0xDA1B, 0x1B1B, 0xDC1D, 0x1D1D, 0x1E1E, 0xDF1E,
+			0xE021, 0x2121, 0x2222, 0xE322, 0x2424, 0xE524, 0xE627, 0x2727,
+			0x2828, 0xE928, 0xEA2B, 0x2B2B, 0xEC2D, 0x2D2D, 0x2E2E, 0xEF2E,
+			0x3030, 0xF130, 0xF233, 0x3333, 0xF435, 0x3535, 0x3636, 0xF736,
+			0xF839, 0x3939, 0x3A3A, 0xFB3A, 0x3C3C, 0xFD3C, 0xFE3F, 0x3F3F,
+			0x8041, 0x4141, 0x4242, 0x8342, 0x4444, 0x8544, 0x8647, 0x4747,
+			0x4848, 0x8948, 0x8A4B, 0x4B4B, 0x8C4D, 0x4D4D, 0x4E4E, 0x8F4E,
+			0x5050, 0x9150, 0x9253, 0x5353, 0x9455, 0x5555, 0x5656, 0x9756,
+			0x9859, 0x5959, 0x5A5A, 0x9B5A, 0x5C5C, 0x9D5C, 0x9E5F, 0x5F5F,
+			0x6060, 0xA160, 0xA263, 0x6363, 0xA465, 0x6565, 0x6666, 0xA766,
+			0xA869, 0x6969, 0x6A6A, 0xAB6A, 0x6C6C, 0xAD6C, 0xAE6F, 0x6F6F,
+			0xB071, 0x7171, 0x7272, 0xB372, 0x7474, 0xB574, 0xB677, 0x7777,
+			0x7878, 0xB978, 0xBA7B, 0x7B7B, 0xBC7D, 0x7D7D, 0x7E7E, 0xBF7E,
+			0x4081, 0x8181, 0x8282, 0x4382, 0x8484, 0x4584, 0x4687, 0x8787,
+			0x8888, 0x4988, 0x4A8B, 0x8B8B, 0x4C8D, 0x8D8D, 0x8E8E, 0x4F8E,
+			0x9090, 0x5190, 0x5293, 0x9393, 0x5495, 0x9595, 0x9696, 0x5796,
+			0x5899, 0x9999, 0x9A9A, 0x5B9A, 0x9C9C, 0x5D9C, 0x5E9F, 0x9F9F,
+			0xA0A0, 0x61A0, 0x62A3, 0xA3A3, 0x64A5, 0xA5A5, 0xA6A6, 0x67A6,
+			0x68A9, 0xA9A9, 0xAAAA, 0x6BAA, 0xACAC, 0x6DAC, 0x6EAF, 0xAFAF,
+			0x70B1, 0xB1B1, 0xB2B2, 0x73B2, 0xB4B4, 0x75B4, 0x76B7, 0xB7B7,
+			0xB8B8, 0x79B8, 0x7ABB, 0xBBBB, 0x7CBD, 0xBDBD, 0xBEBE, 0x7FBE,
+			0xC0C0, 0x01C0, 0x02C3, 0xC3C3, 0x04C5, 0xC5C5, 0xC6C6, 0x07C6,
+			0x08C9, 0xC9C9, 0xCACA, 0x0BCA, 0xCCCC, 0x0DCC, 0x0ECF, 0xCFCF,
+			0x10D1, 0xD1D1, 0xD2D2, 0x13D2, 0xD4D4, 0x15D4, 0x16D7, 0xD7D7,
+			0xD8D8, 0x19D8, 0x1ADB, 0xDBDB, 0x1CDD, 0xDDDD, 0xDEDE, 0x1FDE,
+			0x20E1, 0xE1E1, 0xE2E2, 0x23E2, 0xE4E4, 0x25E4, 0x26E7, 0xE7E7,
+			0xE8E8, 0x29E8, 0x2AEB, 0xEBEB, 0x2CED, 0xEDED, 0xEEEE, 0x2FEE,
+			0xF0F0, 0x31F0, 0x32F3, 0xF3F3, 0x34F5, 0xF5F5, 0xF6F6, 0x37F6,
+			0x38F9, 0xF9F9, 0xFAFA, 0x3BFA, 0xFCFC, 0x3DFC, 0x3EFF, 0xFFFF
+		},
+		{
+			0x0000, 0x00C1, 0x0182, 0x0143, 0x0304, 0x03C5, 0x0286, 0x0247,
+			0x0608, 0x06C9, 0x078A, 0x074B, 0x050C, 0x05CD, 0x048E, 0x044F,
+			0x0C10, 0x0CD1, 0x0D92, 0x0D53, 0x0F14, 0x0FD5, 0x0E96, 0x0E57,
+			0x0A18, 0x0AD9, 0x0B9A, 0x0B5B, 0x091C, 0x09DD, 0x089E, 0x085F,
+			0x1820, 0x18E1, 0x19A2, 0x1963, 0x1B24, 0x1BE5, 0x1AA6, 0x1A67,
+			0x1E28, 0x1EE9, 0x1FAA, 0x1F6B, 0x1D2C, 0x1DED, 0x1CAE, 0x1C6F,
+			0x1430, 0x14F1, 0x15B2, 0x1573, 0x1734, 0x17F5, 0x16B6, 0x1677,
+			0x1238, 0x12F9, 0x13BA, 0x137B, 0x113C, 0x11FD, 0x10BE, 0x107F,
+			0x3040, 0x3081, 0x31C2, 0x3103, 0x3344, 0x3385, 0x32C6, 0x3207,
+			0x3648, 0x3689, 0x37CA, 0x370B, 0x354C, 0x358D, 0x34CE, 0x340F,
+			0x3C50, 0x3C91, 0x3DD2, 0x3D13, 0x3F54, 0x3F95, 0x3ED6, 0x3E17,
+			0x3A58, 0x3A99, 0x3BDA, 0x3B1B, 0x395C, 0x399D, 0x38DE, 0x381F,
+			0x2860, 0x28A1, 0x29E2, 0x2923, 0x2B64, 0x2BA5, 0x2AE6, 0x2A27,
+			0x2E68, 0x2EA9, 0x2FEA, 0x2F2B, 0x2D6C, 0x2DAD, 0x2CEE, 0x2C2F,
+			0x2470, 0x24B1, 0x25F2, 0x2533, 0x2774, 0x27B5, 0x26F6, 0x2637,
+			0x2278, 0x22B9, 0x23FA, 0x233B, 0x217C, 0x21BD, 0x20FE, 0x203F,
+			0x6080, 0x6041, 0x6102, 0x61C3, 0x6384, 0x6345, 0x6206, 0x62C7,
+			0x6688, 0x6649, 0x670A, 0x67CB, 0x658C, 0x654D, 0x640E, 0x64CF,
+			0x6C90, 0x6C51, 0x6D12, 0x6DD3, 0x6F94, 0x6F55, 0x6E16, 0x6ED7,
+			0x6A98, 0x6A59, 0x6B1A, 0x6BDB, 0x699C, 0x695D, 0x681E, 0x68DF,
+			0x78A0, 0x7861, 0x7922, 0x79E3, 0x7BA4, 0x7B65, 0x7A26, 0x7AE7,
+			0x7EA8, 0x7E69, 0x7F2A, 0x7FEB, 0x7DAC, 0x7D6D, 0x7C2E, 0x7CEF,
+			0x74B0, 0x7471, 0x7532, 0x75F3, 0x77B4, 0x7775, 0x7636, 0x76F7,
+			0x72B8, 0x7279, 0x733A, 0x73FB, 0x71BC, 0x717D, 0x703E, 0x70FF,
+			0x50C0, 0x5001, 0x5142, 0x5183, 0x53C4, 0x5305, 0x5246, 0x5287,
+			0x56C8, 0x5609, 0x574A, 0x578B, 0x55CC, 0x550D, 0x544E, 0x548F,
+			0x5CD0, 0x5C11, 0x5D52, 0x5D93, 0x5FD4, 0x5F15, 0x5E56, 0x5E97,
+			0x5AD8, 0x5A19, 0x5B5A, 0x5B9B, 0x59DC, 0x591D, 0x585E, 0x589F,
+			0x48E0, 0x4821, 0x4962, 0x49A3, 0x4BE4, 0x4B25, 0x4A66, 0x4AA7,
+			0x4EE8, 0x4E29, 0x4F6A, 0x4FAB, 0x4DEC, 0x4D2D, 0x4C6E, 0x4CAF,
+			0x44F0, 0x4431, 0x4572, 0x45B3, 0x47F4, 0x4735, 0x4676, 0x46B7,
+			0x42F8, 0x4239, 0x437A, 0x43BB, 0x41FC, 0x413D, 0x407E, 0x40BF
+		},
+		{
+			0x0000, 0x90C1, 0x6181, 0xF140, 0xC302, 0x53C3, 0xA283, 0x3242,
+			0xC607, 0x56C6, 0xA786, 0x3747, 0x0505, 0x95C4, 0x6484, 0xF445,
+			0xCC0D, 0x5CCC, 0xAD8C, 0x3D4D, 0x0F0F, 0x9FCE, 0x6E8E, 0xFE4F,
+			0x0A0A, 0x9ACB, 0x6B8B, 0xFB4A, 0xC908, 0x59C9, 0xA889, 0x3848,
+			0xD819, 0x48D8, 0xB998, 0x2959, 0x1B1B, 0x8BDA, 0x7A9A, 0xEA5B,
+			0x1E1E, 0x8EDF, 0x7F9F, 0xEF5E, 0xDD1C, 0x4DDD, 0xBC9D, 0x2C5C,
+			0x1414, 0x84D5, 0x7595, 0xE554, 0xD716, 0x47D7, 0xB697, 0x2656,
+			0xD213, 0x42D2, 0xB392, 0x2353, 0x1111, 0x81D0, 0x7090, 0xE051,
+			0xF031, 0x60F0, 0x91B0, 0x0171, 0x3333, 0xA3F2, 0x52B2, 0xC273,
+			0x3636, 0xA6F7, 0x57B7, 0xC776, 0xF534, 0x65F5, 0x94B5, 0x0474,
+			0x3C3C, 0xACFD, 0x5DBD, 0xCD7C, 0xFF3E, 0x6FFF, 0x9EBF, 0x0E7E,
+			0xFA3B, 0x6AFA, 0x9BBA, 0x0B7B, 0x3939, 0xA9F8, 0x58B8, 0xC879,
+			0x2828, 0xB8E9, 0x49A9, 0xD968, 0xEB2A, 0x7BEB, 0x8AAB, 0x1A6A,
+			0xEE2F, 0x7EEE, 0x8FAE, 0x1F6F, 0x2D2D, 0xBDEC, 0x4CAC, 0xDC6D,
+			0xE425, 0x74E4, 0x85A4, 0x1565, 0x2727, 0xB7E6, 0x46A6, 0xD667,
+			0x2222, 0xB2E3, 0x43A3, 0xD362, 0xE120, 0x71E1, 0x80A1, 0x1060,
+			0xA061, 0x30A0, 0xC1E0, 0x5121, 0x6363, 0xF3A2, 0x02E2, 0x9223,
+			0x6666, 0xF6A7, 0x07E7, 0x9726, 0xA564, 0x35A5, 0xC4E5, 0x5424,
+			0x6C6C, 0xFCAD, 0x0DED, 0x9D2C, 0xAF6E, 0x3FAF, 0xCEEF, 0x5E2E,
+			0xAA6B, 0x3AAA, 0xCBEA, 0x5B2B, 0x6969, 0xF9A8, 0x08E8, 0x9829,
+			0x7878, 0xE8B9, 0x19F9, 0x8938, 0xBB7A, 0x2BBB, 0xDAFB, 0x4A3A,
+			0xBE7F, 0x2EBE, 0xDFFE, 0x4F3F, 0x7D7D, 0xEDBC, 0x1CFC, 0x8C3D,
+			0xB475, 0x24B4, 0xD5F4, 0x4535, 0x7777, 0xE7B6, 0x16F6, 0x8637,
+			0x7272, 0xE2B3, 0x13F3, 0x8332, 0xB170, 0x21B1, 0xD0F1, 0x4030,
+			0x5050, 0xC091, 0x31D1, 0xA110, 0x9352, 0x0393, 0xF2D3, 0x6212,
+			0x9657, 0x0696, 0xF7D6, 0x6717, 0x5555, 0xC594, 0x34D4, 0xA415,
+			0x9C5D, 0x0C9C, 0xFDDC, 0x6D1D, 0x5F5F, 0xCF9E, 0x3EDE, 0xAE1F,
+			0x5A5A, 0xCA9B, 0x3BDB, 0xAB1A, 0x9958, 0x0999, 0xF8D9, 0x6818,
+			0x8849, 0x1888, 0xE9C8, 0x7909, 0x4B4B, 0xDB8A, 0x2ACA, 0xBA0B,
+			0x4E4E, 0xDE8F, 0x2FCF, 0xBF0E, 0x8D4C, 0x1D8D, 0xECCD, 0x7C0C,
+			0x4444, 0xD485, 0x25C5, 0xB504, 0x8746, 0x1787, 0xE6C7, 0x7606,
+			0x8243, 0x1282, 0xE3C2, 0x7303, 0x4141, 0xD180, 0x20C0, 0xB001
+		}
+#endif
+};
+#endif
+
+/*
+ * The frame CRC is kept byte swapped, so auchCRCHi indexes the low byte of the
+ * reflected register. The slicing engines work on the reflected register.
+ */
+#define TP_CRC16_SWAP(crc)	(uint16_t)((((crc) << 8) & 0xFF00) | (((crc) >> 8) & 0x00FF))
+
+int16_t TP_CRC16AddByteTable(uint8_t *data, int32_t length, int16_t crc)
 {
 	uint8_t tableIndex = 0;
-	int32_t i = 0;
-	uint8_t crcH = 0xFF;
-	uint8_t crcL = 0xFF;
+	uint8_t crcH = (crc >> 8) & 0xFF;
+	uint8_t crcL = crc & 0xFF;
 
-	for (int j = 0; j < length; j++)
-    {
-		tableIndex = (uint8_t) ((crcH ^ data[i++]) & 0xFF);
+	for (int32_t i = 0; i < length; i++)
+	{
+		tableIndex = (uint8_t) ((crcH ^ data[i]) & 0xFF);
 		crcH = (uint8_t)  ((crcL ^ auchCRCHi[tableIndex]) & 0xFF);
 		crcL = (uint8_t)  (auchCRCLo[tableIndex] & 0xFF);
-    }
+	}
 
- 	return ((int16_t)((crcH << 8) | crcL) & 0xFFFF);
+	return ((int16_t)((crcH << 8) | crcL) & 0xFFFF);
 }
 
-int16_t TP_CRC16Add(uint8_t *data, int32_t length, int16_t crc)
+#if TP_CRC16_ENGINE >= TP_CRC_SLICING_8
+static uint16_t TPCRC16Slicing(const uint8_t *data, int32_t length, uint16_t crc)
+{
+	const uint16_t (*table)[256] = TPCRC16Slices;
+	uint16_t c = TP_CRC16_SWAP(crc);
+
+#if TP_CRC16_ENGINE >= TP_CRC_SLICING_16
+	for (; length >= 16; length -= 16, data += 16)
+	{
+		c ^= (uint16_t)(data[0] | (data[1] << 8));
+		c = table[15][c & 0xFF] ^ table[14][c >> 8] ^
+			table[13][data[2]]  ^ table[12][data[3]]  ^
+			table[11][data[4]]  ^ table[10][data[5]]  ^
+			table[9][data[6]]   ^ table[8][data[7]]   ^
+			table[7][data[8]]   ^ table[6][data[9]]   ^
+			table[5][data[10]]  ^ table[4][data[11]]  ^
+			table[3][data[12]]  ^ table[2][data[13]]  ^
+			table[1][data[14]]  ^ table[0][data[15]];
+	}
+#endif
+
+	for (; length >= 8; length -= 8, data += 8)
+	{
+		c ^= (uint16_t)(data[0] | (data[1] << 8));
+		c = table[7][c & 0xFF] ^ table[6][c >> 8] ^
+			table[5][data[2]]  ^ table[4][data[3]]  ^
+			table[3][data[4]]  ^ table[2][data[5]]  ^
+			table[1][data[6]]  ^ table[0][data[7]];
+	}
+
+	while (length-- > 0)
+	{
+		c = (c >> 8) ^ table[0][(c ^ *data++) & 0xFF];
+	}
+
+	return TP_CRC16_SWAP(c);
+}
+
+/* Same as TPCRC16Slicing, storing each block to the destination as it is hashed */
+static uint16_t TPCRC16CopySlicing(uint8_t *destination, const uint8_t *source, int32_t length, uint16_t crc)
+{
+	const uint16_t (*table)[256] = TPCRC16Slices;
+	uint16_t c = TP_CRC16_SWAP(crc);
+	uint8_t block[8];
+
+	for (; length >= 8; length -= 8, source += 8, destination += 8)
+	{
+		memcpy(block, source, 8);
+		memcpy(destination, block, 8);
+
+		c ^= (uint16_t)(block[0] | (block[1] << 8));
+		c = table[7][c & 0xFF] ^ table[6][c >> 8] ^
+			table[5][block[2]]  ^ table[4][block[3]]  ^
+			table[3][block[4]]  ^ table[2][block[5]]  ^
+			table[1][block[6]]  ^ table[0][block[7]];
+	}
+
+	while (length-- > 0)
+	{
+		block[0] = *source++;
+		*destination++ = block[0];
+		c = (c >> 8) ^ table[0][(c ^ block[0]) & 0xFF];
+	}
+
+	return TP_CRC16_SWAP(c);
+}
+#else
+/* Same as TP_CRC16AddByteTable, storing each byte to the destination as it is hashed */
+static uint16_t TPCRC16CopyByteTable(uint8_t *destination, const uint8_t *source, int32_t length, uint16_t crc)
 {
 	uint8_t tableIndex = 0;
-	int32_t i = 0;
 	uint8_t crcH = (crc >> 8) & 0xFF;
 	uint8_t crcL = crc & 0xFF;
 
-	for (int j = 0; j < length; j++)
-    {
-		tableIndex = (uint8_t) ((crcH ^ data[i++]) & 0xFF);
+	for (int32_t i = 0; i < length; i++)
+	{
+		destination[i] = source[i];
+		tableIndex = (uint8_t) ((crcH ^ source[i]) & 0xFF);
 		crcH = (uint8_t)  ((crcL ^ auchCRCHi[tableIndex]) & 0xFF);
 		crcL = (uint8_t)  (auchCRCLo[tableIndex] & 0xFF);
-    }
+	}
+
+	return (uint16_t)((crcH << 8) | crcL);
+}
+#endif
+
+static uint16_t TPCRC16Tables(uint8_t *data, int32_t length, uint16_t crc)
+{
+#if TP_CRC16_ENGINE >= TP_CRC_SLICING_8
+	return TPCRC16Slicing(data, length, crc);
+#else
+	return (uint16_t)TP_CRC16AddByteTable(data, length, (int16_t)crc);
+#endif
+}
+
+/* Copies while hashing, the data is read once */
+static uint16_t TPCRC16CopyTables(uint8_t *destination, const uint8_t *source, int32_t length, uint16_t crc)
+{
+#if TP_CRC16_ENGINE >= TP_CRC_SLICING_8
+	return TPCRC16CopySlicing(destination, source, length, crc);
+#else
+	return TPCRC16CopyByteTable(destination, source, length, crc);
+#endif
+}
+
+#if TP_CRC_CLMUL
+static const TPClmulConstants TPCRC16Fold =
+{
+		.fold512 = { 0xC450000000000000ULL, 0x8101000000000000ULL },
+		.fold128 = { 0xCCD0000000000000ULL, 0xC100000000000000ULL }
+};
+
+int16_t TP_CRC16AddClmul(uint8_t *data, int32_t length, int16_t crc)
+{
+	uint8_t residue[16];
+	int32_t folded = length & ~15;
+
+	if(folded == 0)
+	{
+		return (int16_t)TPCRC16Tables(data, length, (uint16_t)crc);
+	}
+
+	TPClmulFold(data, folded, TP_CRC16_SWAP(crc), &TPCRC16Fold, NULL, residue);
+
+	crc = (int16_t)TPCRC16Tables(residue, sizeof(residue), 0);
+	return (int16_t)TPCRC16Tables(&data[folded], length - folded, (uint16_t)crc);
+}
+#endif
+
+int16_t TP_CRC16Copy(uint8_t *destination, const uint8_t *source, int32_t length, int16_t crc)
+{
+#if TP_CRC_CLMUL
+	if(length >= TP_CRC_CLMUL_THRESHOLD && TPClmulIsSupported())
+	{
+		uint8_t residue[16];
+		int32_t folded = length & ~15;
+
+		/* Each 16 bytes block is loaded once, stored to the destination and folded */
+		TPClmulFold(source, folded, TP_CRC16_SWAP(crc), &TPCRC16Fold, destination, residue);
+
+		crc = (int16_t)TPCRC16Tables(residue, sizeof(residue), 0);
+		return (int16_t)TPCRC16CopyTables(&destination[folded], &source[folded], length - folded, (uint16_t)crc);
+	}
+#endif
+
+	return (int16_t)TPCRC16CopyTables(destination, source, length, (uint16_t)crc);
+}
+
+int16_t TP_CRC16(uint8_t *data, int32_t length)
+{
+	return TP_CRC16Add(data, length, (int16_t)0xFFFF);
+}
+
+int16_t TP_CRC16Add(uint8_t *data, int32_t length, int16_t crc)
+{
+#if TP_CRC_CLMUL
+	if(length >= TP_CRC_CLMUL_THRESHOLD && TPClmulIsSupported())
+	{
+		return TP_CRC16AddClmul(data, length, crc);
+	}
+#endif
 
- 	return ((int16_t)((crcH << 8) | crcL) & 0xFFFF);
+	return (int16_t)TPCRC16Tables(data, length, (uint16_t)crc);
 }
@@ -25,5 +25,32 @@ int16_t TP_CRC16(uint8_t *data, int32_t length);
  */ 
 int16_t TP_CRC16Add(uint8_t *data, int32_t length, int16_t crc);
 
+/**
+ * @internal
+ * Copies a buffer and adds it to the CRC in the same pass.
+ *
+ * @param destination Buffer which receives the data.
+ * @param source      Data to be copied and hashed.
+ * @param length      Amount of data.
+ * @param crc         CRC before the data.
+ *
+ * @return Returns the CRC16 Modbus value including the data copied.
+ */
+int16_t TP_CRC16Copy(uint8_t *destination, const uint8_t *source, int32_t length, int16_t crc);
+
+/**
+ * @internal
+ * Reference implementation with the byte tables, whatever TP_CRC16_ENGINE is.
+ */
+int16_t TP_CRC16AddByteTable(uint8_t *data, int32_t length, int16_t crc);
+
+#if TP_CRC_CLMUL
+/**
+ * @internal
+ * Carry-less multiply folding. Must only be called if TPClmulIsSupported() returns true.
+ */
+int16_t TP_CRC16AddClmul(uint8_t *data, int32_t length, int16_t crc);
+#endif
+
 
 #endif /* CRC16_H_ */
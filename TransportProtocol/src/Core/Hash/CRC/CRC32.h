@@ -10,9 +10,55 @@
 
 #include "../../Settings.h"
 
+/*!
+ * @internal
+ * Starts a CRC32 IEEE calculation.
+ *
+ * @return Returns the initial CRC register.
+ */
+uint32_t TP_CRC32Init(void);
+
+/*!
+ * @internal
+ * Adds a block of data to a CRC32 IEEE calculation. May be called many times,
+ * e.g. once for each firmware chunk received.
+ *
+ * @param crc    Register returned by TP_CRC32Init or by the previous update.
+ * @param data   Data buffer.
+ * @param length Data buffer size.
+ *
+ * @return Returns the updated CRC register.
+ */
+uint32_t TP_CRC32Update(uint32_t crc, const uint8_t *data, uint32_t length);
+
+/*!
+ * @internal
+ * Finishes a CRC32 IEEE calculation.
+ *
+ * @param crc Register returned by the last TP_CRC32Update.
+ *
+ * @return Returns the CRC32 IEEE value.
+ */
+uint32_t TP_CRC32Final(uint32_t crc);
+
+/**
+ * @internal
+ * Reference implementation with the byte table, whatever TP_CRC32_ENGINE is.
+ */
+uint32_t TP_CRC32UpdateByteTable(uint32_t crc, const uint8_t *data, uint32_t length);
+
+#if TP_CRC_CLMUL
 /**
  * @internal
- */ 
+ * Carry-less multiply folding. Must only be called if TPClmulIsSupported() returns true.
+ */
+uint32_t TP_CRC32UpdateClmul(uint32_t crc, const uint8_t *data, uint32_t length);
+#endif
+
+/**
+ * @internal
+ * CRC32 IEEE of a whole buffer.
+ */
 int32_t GetCRC32(uint8_t *data, int16_t offset, int32_t length);
 
 
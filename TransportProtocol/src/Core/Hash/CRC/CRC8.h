@@ -0,0 +1,24 @@
+/*
+ * CRC8.h
+ *
+ *  Created on: 18/10/2026
+ *      Eng. Douglas Reis
+ */
+
+#ifndef CRC8_H_
+#define CRC8_H_
+
+#include "../../Settings.h"
+
+/*!
+ * @internal
+ * CRC-8, polynomial 0x07, used to check the frame header before waiting for its payload.
+ *
+ * @param data   Data to be hashed.
+ * @param length Amount of data.
+ *
+ * @return Returns the CRC8 value.
+ */
+uint8_t TP_CRC8(const uint8_t *data, int32_t length);
+
+#endif /* CRC8_H_ */
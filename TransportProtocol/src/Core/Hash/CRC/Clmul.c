@@ -0,0 +1,97 @@
+/*
+ * Clmul.c
+ *
+ *  Created on: 18/10/2026
+ *      Eng. Douglas Reis
+ */
+
+#include "Clmul.h"
+
+#if TP_CRC_CLMUL
+
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <wmmintrin.h>
+
+#define TP_CLMUL_TARGET __attribute__ ((target ("sse2,pclmul")))
+
+bool TPClmulIsSupported(void)
+{
+	static int8_t supported = -1;
+
+	if(supported < 0)
+	{
+		unsigned int eax, ebx, ecx, edx;
+
+		supported = 0;
+		if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & bit_PCLMUL) && (edx & bit_SSE2))
+		{
+			supported = 1;
+		}
+	}
+
+	return supported == 1;
+}
+
+/*
+ * The low lane holds the first 8 bytes, that is the highest degree half of the
+ * 128 bits polynomial, and is multiplied by x^(distance+64). The product of two
+ * reflected lanes comes out shifted by one degree, hence the -1 in the constants.
+ */
+TP_CLMUL_TARGET static inline __m128i TPClmulFoldLane(__m128i x, __m128i k)
+{
+	return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/* Loads 16 bytes of the buffer, storing them to the copy when there is one */
+TP_CLMUL_TARGET static inline __m128i TPClmulLoad(const uint8_t *data, uint8_t *copy, int32_t offset)
+{
+	__m128i x = _mm_loadu_si128((const __m128i *)&data[offset]);
+
+	if(copy != NULL)
+	{
+		_mm_storeu_si128((__m128i *)&copy[offset], x);
+	}
+
+	return x;
+}
+
+TP_CLMUL_TARGET void TPClmulFold(const uint8_t *data, int32_t length, uint32_t init, const TPClmulConstants *constants, uint8_t *copy, uint8_t residue[16])
+{
+	const __m128i k128 = _mm_loadu_si128((const __m128i *)constants->fold128);
+	__m128i x0 = _mm_xor_si128(TPClmulLoad(data, copy, 0), _mm_cvtsi32_si128((int)init));
+	int32_t offset;
+
+	if(length >= 64)
+	{
+		const __m128i k512 = _mm_loadu_si128((const __m128i *)constants->fold512);
+		__m128i x1 = TPClmulLoad(data, copy, 16);
+		__m128i x2 = TPClmulLoad(data, copy, 32);
+		__m128i x3 = TPClmulLoad(data, copy, 48);
+
+		for(offset = 64; length - offset >= 64; offset += 64)
+		{
+			x0 = _mm_xor_si128(TPClmulFoldLane(x0, k512), TPClmulLoad(data, copy, offset));
+			x1 = _mm_xor_si128(TPClmulFoldLane(x1, k512), TPClmulLoad(data, copy, offset + 16));
+			x2 = _mm_xor_si128(TPClmulFoldLane(x2, k512), TPClmulLoad(data, copy, offset + 32));
+			x3 = _mm_xor_si128(TPClmulFoldLane(x3, k512), TPClmulLoad(data, copy, offset + 48));
+		}
+
+		x0 = _mm_xor_si128(TPClmulFoldLane(x0, k128), x1);
+		x0 = _mm_xor_si128(TPClmulFoldLane(x0, k128), x2);
+		x0 = _mm_xor_si128(TPClmulFoldLane(x0, k128), x3);
+	}
+	else
+	{
+		offset = 16;
+	}
+
+	for(; offset < length; offset += 16)
+	{
+		x0 = _mm_xor_si128(TPClmulFoldLane(x0, k128), TPClmulLoad(data, copy, offset));
+	}
+
+	_mm_storeu_si128((__m128i *)residue, x0);
+}
+
+#endif
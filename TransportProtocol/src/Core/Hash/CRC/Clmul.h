@@ -0,0 +1,53 @@
+/*
+ * Clmul.h
+ *
+ *  Created on: 18/10/2026
+ *      Eng. Douglas Reis
+ */
+
+#ifndef CLMUL_H_
+#define CLMUL_H_
+
+#include <stddef.h>
+
+#include "../../Settings.h"
+
+#if TP_CRC_CLMUL
+
+/*!
+ * @internal
+ * Folding constants of a reflected CRC, each one stored bit reflected in the
+ * upper bits of a 64 bit lane.
+ */
+typedef struct
+{
+	uint64_t fold512[2];	/*!< x^(512+63) mod P and x^(512-1) mod P */
+	uint64_t fold128[2];	/*!< x^(128+63) mod P and x^(128-1) mod P */
+} TPClmulConstants;
+
+/*!
+ * @internal
+ * Checks through CPUID whether the carry-less multiply instructions are available.
+ *
+ * @return Returns true if the folding kernel can be used.
+ */
+bool TPClmulIsSupported(void);
+
+/*!
+ * @internal
+ * Folds a buffer into a 16 bytes residue with the same remainder modulo the CRC polynomial.
+ *
+ * The CRC of the buffer is the CRC, with a zero initial value, of the residue.
+ *
+ * @param data      Data buffer.
+ * @param length    Data buffer size, multiple of 16 and not zero.
+ * @param init      Reflected CRC register before the buffer.
+ * @param constants Folding constants of the CRC polynomial.
+ * @param copy      Receives a copy of the buffer in the same pass, or NULL.
+ * @param residue   Receives the 16 bytes residue.
+ */
+void TPClmulFold(const uint8_t *data, int32_t length, uint32_t init, const TPClmulConstants *constants, uint8_t *copy, uint8_t residue[16]);
+
+#endif
+
+#endif /* CLMUL_H_ */
@@ -0,0 +1,168 @@
+/**
+ * @file    Arq.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#include "Arq.h"
+#include "Helper.h"
+
+static bool TPArqSendControl(TP_Context *context, uint8_t address, uint8_t *payload, uint16_t size)
+{
+	Frame frame = { .address = address, .data = payload };
+
+	SET_STX(frame.stx);
+	TP_Int16ToArray(size, frame.size);
+
+	/* The command frame may belong to a TP_Send in progress */
+	return TPSend(context, &frame);
+}
+
+bool TPArqSend(TP_Context *context, uint8_t address, const TP_IOVec *parts, uint8_t count)
+{
+	TPArq *arq = &context->arq;
+	uint8_t *slot = TPArqSlot(context, TPArqTxIndex(context, arq->next));
+	uint8_t *payload = &slot[TP_ARQ_SLOT_HEADER_SIZE + TP_ARQ_HEADER_SIZE];
+	uint32_t size = 0;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		size += parts[i].size;
+	}
+
+	context->tx.status = TPArqUpdateStatus(context);
+	TP_ASSERT(context->tx.status != TPSuccess);
+
+	/* The frame size field also counts the ARQ header */
+	context->tx.status = TPBufferOverflow;
+	TP_ASSERT(size > UINT16_MAX - TP_ARQ_HEADER_SIZE);
+	TP_ASSERT(TP_ARQ_SLOT_HEADER_SIZE + TP_ARQ_HEADER_SIZE + size > arq->slotSize);
+
+	context->tx.status = TPIsRunning;
+	TP_ASSERT((uint8_t)(arq->next - arq->base) >= arq->window);
+
+	TP_Int16ToArray(size, slot);
+	slot[2] = address;
+	slot[TP_ARQ_SLOT_TRIALS] = 1;
+	slot[TP_ARQ_SLOT_HEADER_SIZE] = TP_ARQ_DATA;
+	slot[TP_ARQ_SLOT_HEADER_SIZE + 1] = arq->next;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		memcpy(payload, parts[i].buffer, parts[i].size);
+		payload += parts[i].size;
+	}
+
+	arq->acked &= ~TPArqTxBit(context, arq->next);
+	arq->next++;
+
+	/* Kept in the window even if the write fails, the timer sends it again */
+	TPArqTransmit(context, slot[TP_ARQ_SLOT_HEADER_SIZE + 1]);
+	return true;
+
+	end:
+	return false;
+}
+
+bool TPArqTransmit(TP_Context *context, uint8_t sequence)
+{
+	uint8_t *slot = TPArqSlot(context, TPArqTxIndex(context, sequence));
+	uint32_t now = context->driver.Tick();
+	uint16_t size = TP_ArrayToInt16(slot) + TP_ARQ_HEADER_SIZE;
+	Frame frame = { .address = slot[2], .data = &slot[TP_ARQ_SLOT_HEADER_SIZE] };
+
+	SET_STX(frame.stx);
+	TP_Int16ToArray(size, frame.size);
+
+	TP_Int32ToArray(now, (&slot[TP_ARQ_SLOT_SENT_AT]));
+
+	return TPSend(context, &frame);
+}
+
+void TPArqSendAck(TP_Context *context, uint8_t address)
+{
+	TPArq *arq = &context->arq;
+	uint8_t ack[TP_ARQ_ACK_SIZE] = { TP_ARQ_ACK, arq->expected };
+	uint32_t selective = 0;
+
+	for(uint8_t i = 1; i < arq->window; i++)
+	{
+		if(arq->received & TPArqRxBit(context, arq->expected + i))
+		{
+			selective |= 1UL << (i - 1);
+		}
+	}
+
+	TP_Int32ToArray(selective, (&ack[2]));
+	TPArqSendControl(context, address, ack, sizeof(ack));
+}
+
+void TPArqSendNak(TP_Context *context, uint8_t address, uint8_t sequence)
+{
+	TPArq *arq = &context->arq;
+	uint8_t nak[TP_ARQ_HEADER_SIZE] = { TP_ARQ_NAK, sequence };
+
+	if(arq->nakSent == false || arq->nakSequence != sequence)
+	{
+		arq->nakSequence = sequence;
+		arq->nakSent = true;
+
+		TPArqSendControl(context, address, nak, sizeof(nak));
+	}
+}
+
+TPStatus TPArqUpdateStatus(TP_Context *context)
+{
+	TPArq *arq = &context->arq;
+	TPStatus status = TPSuccess;
+
+	for(uint8_t sequence = arq->base; sequence != arq->next; sequence++)
+	{
+		uint8_t *slot = TPArqSlot(context, TPArqTxIndex(context, sequence));
+
+		/* The counter passes the trials once the timer of the last transmission expired */
+		if((arq->acked & TPArqTxBit(context, sequence)) == 0 && slot[TP_ARQ_SLOT_TRIALS] > arq->trials)
+		{
+			status = TPTimeout;
+		}
+	}
+
+	if(status != arq->status && status == TPTimeout)
+	{
+		TPLog(TPTimeout, "Frame not acknowledged");
+	}
+
+	arq->status = status;
+	return status;
+}
+
+void TPArqCheckTimers(TP_Context *context)
+{
+	TPArq *arq = &context->arq;
+	uint32_t now = context->driver.Tick();
+
+	for(uint8_t sequence = arq->base; sequence != arq->next; sequence++)
+	{
+		uint8_t *slot = TPArqSlot(context, TPArqTxIndex(context, sequence));
+
+		if((arq->acked & TPArqTxBit(context, sequence)) == 0 &&
+		   (now - TP_ArrayToInt32((&slot[TP_ARQ_SLOT_SENT_AT]))) > arq->retransmitTimeout)
+		{
+			/* Only the timer counts, a frame out of trials keeps probing the peer */
+			if(slot[TP_ARQ_SLOT_TRIALS] < UINT8_MAX)
+			{
+				slot[TP_ARQ_SLOT_TRIALS]++;
+			}
+			TPArqTransmit(context, sequence);
+		}
+	}
+
+	TPArqUpdateStatus(context);
+}
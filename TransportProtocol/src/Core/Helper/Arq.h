@@ -0,0 +1,116 @@
+/**
+ * @file    Arq.h
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Selective repeat ARQ of the reliable mode, enabled by TP_SetArq.
+ *
+ * Every payload starts with a header of type and sequence:
+ * | Type     | Payload                                                            |
+ * |:--       |:--                                                                 |
+ * | **DATA** | Sequence (1) followed by the application payload.                  |
+ * | **ACK**  | Next sequence expected (1) and 32 bits, big endian, where bit i    |
+ * |          | acknowledges the frame expected + 1 + i held out of order.         |
+ * | **NAK**  | Sequence (1) of a missing frame, sent again before its timeout.    |
+ *
+ * Window slots keep the frame as
+ * | Size (2) | Address (1) | Trials (1) | Sent at (4) | Type (1) | Sequence (1) | Payload |,
+ * where trials and sent at, the tick of the last transmission, are only used by
+ * the send window.
+ */
+
+#ifndef TPARQ_H_
+#define TPARQ_H_
+
+#include "../Type/Context.h"
+
+#define TP_ARQ_DATA				0x01
+#define TP_ARQ_ACK				0x02
+#define TP_ARQ_NAK				0x03
+
+#define TP_ARQ_HEADER_SIZE		2		/*!< Type and sequence */
+#define TP_ARQ_ACK_SIZE			6		/*!< Type, next sequence expected and selective bits */
+#define TP_ARQ_SLOT_HEADER_SIZE	8		/*!< Size, address, trials and sent at kept before the frame payload */
+#define TP_ARQ_SLOT_TRIALS		3		/*!< Offset of the transmissions counted by the timer */
+#define TP_ARQ_SLOT_SENT_AT		4		/*!< Offset of the tick of the last transmission */
+
+#define TPArqSlot(context, index)	(&(context)->arq.buffer[(index) * (context)->arq.slotSize])
+
+/* Slots follow base and expected, seq % window would skip at the 8 bits wrap unless window divides 256 */
+#define TPArqTxIndex(context, seq)	(((context)->arq.baseIndex + (uint8_t)((seq) - (context)->arq.base)) % (context)->arq.window)
+#define TPArqRxIndex(context, seq)	(((context)->arq.expectedIndex + (uint8_t)((seq) - (context)->arq.expected)) % (context)->arq.window)
+#define TPArqTxBit(context, seq)	(1UL << TPArqTxIndex(context, seq))
+#define TPArqRxBit(context, seq)	(1UL << TPArqRxIndex(context, seq))
+
+/* True if seq is in the window of size frames starting at base, with 8 bits wrapping */
+#define TPArqIsInWindow(seq, base, size)	((uint8_t)((seq) - (base)) < (size))
+
+/*!
+ * @internal
+ * Keeps a payload in the send window and sends it.
+ *
+ * @param context Current context.
+ * @param address Destination address.
+ * @param parts   Parts of the payload, copied one after the other.
+ * @param count   Amount of parts.
+ * @return Returns false if the window is full, the payload doesn't fit a slot or
+ * a frame in flight ran out of trials, see TPTxControl::status.
+ */
+bool TPArqSend(TP_Context *context, uint8_t address, const TP_IOVec *parts, uint8_t count);
+
+/*!
+ * @internal
+ * Sends again a frame of the send window and restarts its timer, without
+ * counting a trial, e.g. when a NAK asks for it.
+ *
+ * @param context  Current context.
+ * @param sequence Sequence of the frame.
+ * @return Returns true if the frame was written.
+ */
+bool TPArqTransmit(TP_Context *context, uint8_t sequence);
+
+/*!
+ * @internal
+ * Sends the cumulative and selective acknowledgement of the reorder window.
+ *
+ * @param context Current context.
+ * @param address Destination address.
+ */
+void TPArqSendAck(TP_Context *context, uint8_t address);
+
+/*!
+ * @internal
+ * Asks for a missing frame, once per gap.
+ *
+ * @param context  Current context.
+ * @param address  Destination address.
+ * @param sequence Missing frame.
+ */
+void TPArqSendNak(TP_Context *context, uint8_t address, uint8_t sequence);
+
+/*!
+ * @internal
+ * Sends again the frames not acknowledged within the retransmission timeout,
+ * each one counting a trial.
+ *
+ * @param context Current context.
+ */
+void TPArqCheckTimers(TP_Context *context);
+
+/*!
+ * @internal
+ * Reports the link down while a frame in flight ran out of trials, i.e. the timer
+ * of its last transmission expired, and up again once the peer acknowledges it.
+ *
+ * @param context Current context.
+ * @return TPTimeout while a frame is out of trials, otherwise TPSuccess.
+ */
+TPStatus TPArqUpdateStatus(TP_Context *context);
+
+#endif /* TPARQ_H_ */
@@ -0,0 +1,113 @@
+/**
+ * @file    Fragment.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#include "Fragment.h"
+#include "Helper.h"
+#include "Arq.h"
+
+bool TPSendFragmented(TP_Context *context, uint8_t address, const uint8_t *payload, uint32_t size)
+{
+	TPArq *arq = &context->arq;
+	uint32_t chunk = context->fragment.fragmentSize - TP_FRAGMENT_HEADER_SIZE;
+	uint32_t count = (size == 0) ? 1 : (size + chunk - 1) / chunk;
+
+	/* A payload is never left half sent because the window filled up */
+	context->tx.status = TPIsRunning;
+	TP_ASSERT(arq->window > 0 && count > (uint32_t)(arq->window - (uint8_t)(arq->next - arq->base)));
+
+	for(uint32_t i = 0, offset = 0; i < count; i++, offset += chunk)
+	{
+		uint8_t header[TP_FRAGMENT_HEADER_SIZE];
+		TP_IOVec parts[] =
+		{
+				{ .buffer = header,            .size = TP_FRAGMENT_HEADER_SIZE },
+				{ .buffer = &payload[offset],  .size = (size - offset < chunk) ? size - offset : chunk }
+		};
+		bool sent = false;
+
+		header[0] = ((i == 0) ? TP_FRAGMENT_FIRST : 0) | ((i == count - 1) ? TP_FRAGMENT_LAST : 0);
+		TP_Int32ToArray(offset, (&header[1]));
+
+		if(arq->window > 0)
+		{
+			sent = TPArqSend(context, address, parts, 2);
+		}
+		else
+		{
+			sent = TPSendParts(context, address, parts, 2);
+		}
+		TP_ASSERT(sent == false);
+	}
+
+	return true;
+
+	end:
+	return false;
+}
+
+void TPReassemble(TP_Context *context, uint8_t address, uint8_t *payload, uint32_t size)
+{
+	TPFragment *fragment = &context->fragment;
+	uint8_t flags = 0;
+	uint32_t offset = 0;
+
+	if(size < TP_FRAGMENT_HEADER_SIZE)
+	{
+		context->control.status = TPFrameError;
+		return;
+	}
+
+	flags = payload[0];
+	offset = TP_ArrayToInt32((&payload[1]));
+	payload += TP_FRAGMENT_HEADER_SIZE;
+	size -= TP_FRAGMENT_HEADER_SIZE;
+
+	if(flags & TP_FRAGMENT_FIRST)
+	{
+		fragment->length = 0;
+		fragment->discarding = false;
+	}
+
+	if(fragment->discarding == true)
+	{
+		/* Waits for the first fragment of the next payload */
+		return;
+	}
+
+	if(offset != fragment->length)
+	{
+		TPLog(TPFrameError, "Fragment lost");
+		context->control.status = TPFrameError;
+		fragment->discarding = true;
+	}
+	else if(size > fragment->size - fragment->length)
+	{
+		context->control.status = TPBufferOverflow;
+		fragment->discarding = true;
+	}
+	else
+	{
+		memcpy(&fragment->buffer[fragment->length], payload, size);
+		fragment->length += size;
+
+		if(flags & TP_FRAGMENT_LAST)
+		{
+			fragment->discarding = true;
+
+			if(context->callback)
+			{
+				TPCallback(context, address, fragment->length, fragment->buffer);
+			}
+		}
+	}
+}
@@ -0,0 +1,53 @@
+/**
+ * @file    Fragment.h
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Fragmentation of payloads larger than a frame, enabled by TP_SetFragmentation.
+ *
+ * Every payload starts with | Flags (1) | Offset (4, big endian) |, the offset
+ * being the position of the fragment in the whole payload.
+ */
+
+#ifndef TPFRAGMENT_H_
+#define TPFRAGMENT_H_
+
+#include "../Type/Context.h"
+
+#define TP_FRAGMENT_FIRST		0x01
+#define TP_FRAGMENT_LAST		0x02
+
+#define TP_FRAGMENT_HEADER_SIZE	5		/*!< Flags and offset */
+
+/*!
+ * @internal
+ * Sends a payload in fragments of up to TPFragment::fragmentSize bytes, through
+ * the ARQ window when it is enabled.
+ *
+ * @param context Current context.
+ * @param address Destination address.
+ * @param payload Application payload.
+ * @param size    Payload size.
+ * @return Returns true if every fragment was sent.
+ */
+bool TPSendFragmented(TP_Context *context, uint8_t address, const uint8_t *payload, uint32_t size);
+
+/*!
+ * @internal
+ * Appends a fragment to the reassembly buffer and delivers the payload to the
+ * callback once its last fragment arrives.
+ *
+ * @param context Current context.
+ * @param address Address of the frame.
+ * @param payload Fragment, with its header.
+ * @param size    Fragment size.
+ */
+void TPReassemble(TP_Context *context, uint8_t address, uint8_t *payload, uint32_t size);
+
+#endif /* TPFRAGMENT_H_ */
@@ -14,27 +14,389 @@
 #include "Helper.h"
 
 #include "../Hash/CRC/CRC16.h"
+#include "../Hash/CRC/CRC8.h"
+#include "Fragment.h"
 
-bool TPSendFrame(TP_Context *context, const Frame *frame)
+static bool TPWriteVector(TP_Context *context, TP_IOVec *vector, uint8_t count)
 {
 	void *handle = context->control.handle;
+	TPTxControl *tx = &context->tx;
 
-	uint16_t _size = TPGetSize(frame->size);
+	tx->timeout = context->driver.Tick();
+	tx->bytesWritten = 0;
+	tx->status = TPIsRunning;
+
+	while(count > 0)
+	{
+		uint32_t pending = 0;
+		uint32_t written = 0;
+
+		for(uint8_t i = 0; i < count; i++)
+		{
+			pending += vector[i].size;
+		}
+
+		if(context->driver.WriteV != NULL && count > 1)
+		{
+			written = context->driver.WriteV(handle, vector, count);
+		}
+		else
+		{
+			pending = vector->size;
+			written = context->driver.Write(handle, vector->buffer, vector->size);
+		}
+
+		if(written > pending)
+		{
+			TPLog(TPErrorSending, "Write error");
+			tx->status = TPErrorSending;
+			context->counters.sendErrors++;
+			return false;
+		}
+
+		if(written == 0)
+		{
+			if((context->driver.Tick() - tx->timeout) > context->control.timeoutConfig)
+			{
+				TPLog(TPTimeout, "Write timeout");
+				tx->status = TPTimeout;
+				context->counters.sendErrors++;
+				return false;
+			}
+
+			/* The driver is full, gives it a tick to drain instead of spinning on Write and Tick */
+			if(context->driver.Sleep != NULL)
+			{
+				context->driver.Sleep(1);
+			}
+			continue;
+		}
+
+		tx->bytesWritten += written;
+
+		/* Skip what was written, a short write resumes in the middle of a buffer */
+		while(count > 0 && written >= vector->size)
+		{
+			written -= vector->size;
+			vector++;
+			count--;
+		}
+
+		if(count > 0)
+		{
+			vector->buffer = (const uint8_t *)vector->buffer + written;
+			vector->size -= written;
+		}
+
+		tx->timeout = context->driver.Tick();
+	}
+
+	tx->status = TPSuccess;
+	context->counters.framesSent++;
+	context->counters.bytesSent += tx->bytesWritten;
+	return true;
+}
+
+bool TPWriteAll(TP_Context *context, TP_IOVec *vector, uint8_t count)
+{
+	TP_IOVec frame[TP_PARTS_MAX + 2];
+	bool ret = false;
+
+	if(context->capture.callback == NULL || count > sizeof(frame) / sizeof(frame[0]))
+	{
+		return TPWriteVector(context, vector, count);
+	}
+
+	/* The vector is consumed by the writes */
+	memcpy(frame, vector, count * sizeof(TP_IOVec));
+
+	ret = TPWriteVector(context, vector, count);
+	TPCaptureFrame(context, TP_CAPTURE_TX, context->tx.status, frame, count);
+
+	return ret;
+}
+
+bool TPSend(TP_Context *context, Frame *frame)
+{
+	uint32_t frameSize = TP_STARTING_FRAME_SIZE + TPGetSize(frame->size) + TP_CRC_SIZE;
+
+	/* The check byte doesn't fit the Frame struct */
+	if(context->options & TP_OPTION_HEADER_CHECK)
+	{
+		TP_IOVec part = { .buffer = frame->data, .size = TPGetSize(frame->size) };
+
+		return TPSendParts(context, frame->address, &part, 1);
+	}
+
+	if(context->tx.buffer != NULL && frameSize <= context->tx.size)
+	{
+		return TPSendStagedFrame(context, frame);
+	}
+
+	/*Calcula CRC16*/
+	TPCalculateCRC(frame);
+
+	/* Envia comando */
+	return TPSendFrame(context, frame);
+}
+
+bool TPSendParts(TP_Context *context, uint8_t address, const TP_IOVec *parts, uint8_t count)
+{
+	uint8_t header[TP_HEADER_MAX_SIZE];
+	uint8_t crcField[TP_CRC_SIZE];
+	uint8_t headerSize = 0;
+	TP_IOVec vector[TP_PARTS_MAX + 2];
+	uint32_t size = 0;
+	uint16_t crc = 0;
+
+	TP_ASSERT(count > TP_PARTS_MAX);
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		size += parts[i].size;
+	}
 
-	uint8_t *auxiliar = (uint8_t *)frame;
+	headerSize = TPEncodeHeader(context, address, size, header);
+	TP_ASSERT(headerSize == 0);
 
-	if(context->driver.Write(handle, (const void *)auxiliar, TP_STARTING_FRAME_SIZE) == TP_STARTING_FRAME_SIZE)
+	crc = TP_CRC16(header, headerSize);
+
+	if(context->tx.buffer != NULL && headerSize + size + TP_CRC_SIZE <= context->tx.size)
 	{
-		if(context->driver.Write(handle, frame->data, _size) == _size)
+		uint8_t *buffer = context->tx.buffer;
+
+		memcpy(buffer, header, headerSize);
+		buffer += headerSize;
+
+		for(uint8_t i = 0; i < count; i++)
 		{
-			if(context->driver.Write(context->control.handle, &frame->crc, TP_CRC_SIZE) == TP_CRC_SIZE)
-				return true;
+			crc = TP_CRC16Copy(buffer, parts[i].buffer, parts[i].size, crc);
+			buffer += parts[i].size;
 		}
+		SET_LITTLE_ENDIAN_INT16(~crc, buffer);
+
+		vector[0].buffer = context->tx.buffer;
+		vector[0].size = headerSize + size + TP_CRC_SIZE;
+
+		return TPWriteAll(context, vector, 1);
 	}
 
+	vector[0].buffer = header;
+	vector[0].size = headerSize;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		crc = TP_CRC16Add((uint8_t *)parts[i].buffer, parts[i].size, crc);
+		vector[i + 1] = parts[i];
+	}
+	SET_LITTLE_ENDIAN_INT16(~crc, crcField);
+
+	vector[count + 1].buffer = crcField;
+	vector[count + 1].size = TP_CRC_SIZE;
+
+	return TPWriteAll(context, vector, count + 2);
+
+	end:
 	return false;
 }
 
+uint8_t TPEncodeHeader(TP_Context *context, uint8_t address, uint32_t size, uint8_t *header)
+{
+	uint8_t headerSize = 0;
+
+	if(size <= UINT16_MAX)
+	{
+		memcpy(header, TP_STX, TP_STX_SIZE);
+		header[2] = address;
+		TP_Int16ToArray(size, (&header[3]));
+
+		headerSize = TP_STARTING_FRAME_SIZE;
+	}
+	else if(context->options & TP_OPTION_JUMBO)
+	{
+		memcpy(header, TP_STX_JUMBO, TP_STX_SIZE);
+		header[2] = address;
+		TP_Int32ToArray(size, (&header[3]));
+
+		headerSize = TP_JUMBO_HEADER_SIZE;
+	}
+
+	if(headerSize != 0 && (context->options & TP_OPTION_HEADER_CHECK))
+	{
+		header[headerSize] = TP_CRC8(header, headerSize);
+		headerSize += TP_HEADER_CHECK_SIZE;
+	}
+
+	return headerSize;
+}
+
+uint8_t TPHeaderSize(TP_Context *context, const uint8_t *stx)
+{
+	uint8_t headerSize = 0;
+
+	if(stx[0] == TP_STX[0] && stx[1] == TP_STX[1])
+	{
+		headerSize = TP_STARTING_FRAME_SIZE;
+	}
+	else if(stx[0] == TP_STX_JUMBO[0] && stx[1] == TP_STX_JUMBO[1] && (context->options & TP_OPTION_JUMBO))
+	{
+		headerSize = TP_JUMBO_HEADER_SIZE;
+	}
+
+	if(headerSize != 0 && (context->options & TP_OPTION_HEADER_CHECK))
+	{
+		headerSize += TP_HEADER_CHECK_SIZE;
+	}
+
+	return headerSize;
+}
+
+bool TPDecodeHeader(TP_Context *context, const uint8_t *header)
+{
+	TPControl *control = &context->control;
+
+	if((context->options & TP_OPTION_HEADER_CHECK) &&
+	   TP_CRC8(header, control->headerSize - TP_HEADER_CHECK_SIZE) != header[control->headerSize - TP_HEADER_CHECK_SIZE])
+	{
+		return false;
+	}
+
+	if(header[1] == TP_STX_JUMBO[1])
+	{
+		control->payloadSize = TP_ArrayToInt32((&header[3]));
+	}
+	else
+	{
+		control->payloadSize = TP_ArrayToInt16((&header[3]));
+	}
+	context->response.address = header[2];
+
+	return true;
+}
+
+void TPDeliver(TP_Context *context, uint8_t address, uint8_t *payload, uint32_t size)
+{
+	if(context->fragment.buffer != NULL)
+	{
+		TPReassemble(context, address, payload, size);
+	}
+	else if(context->callback)
+	{
+		if(payload >= context->response.data && payload < &context->response.data[context->slots.size])
+		{
+			TPHoldSlot(context);
+		}
+
+		TPCallback(context, address, size, payload);
+	}
+}
+
+void TPCallback(TP_Context *context, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	uint32_t start = 0;
+
+	if(context->histograms == NULL)
+	{
+		context->callback(context->param, address, size, payload);
+		return;
+	}
+
+	start = context->driver.Tick();
+	context->callback(context->param, address, size, payload);
+	TPHistogramAdd(context->histograms->callbackTime, context->driver.Tick() - start);
+}
+
+void TPHistogramAdd(uint32_t *histogram, uint32_t value)
+{
+	uint8_t bucket = 0;
+
+	while(value != 0 && bucket < TP_HISTOGRAM_BUCKETS - 1)
+	{
+		value >>= 1;
+		bucket++;
+	}
+
+	histogram[bucket]++;
+}
+
+void TPCountFrame(TP_Context *context)
+{
+	TPCounters *counters = &context->counters;
+
+	switch(context->control.status)
+	{
+	case TPSuccess:
+		counters->framesReceived++;
+		counters->bytesReceived += context->control.payloadSize;
+		if(context->histograms != NULL)
+		{
+			TPHistogramAdd(context->histograms->receiveTime, context->driver.Tick() - context->control.started);
+		}
+		break;
+	case TPErrorChecksum:
+		counters->crcErrors++;
+		break;
+	case TPBufferOverflow:
+		counters->overflows++;
+		break;
+	case TPFrameError:
+		counters->frameErrors++;
+		break;
+	case TPTimeout:
+		counters->timeouts++;
+		break;
+	default:
+		break;
+	}
+}
+
+void TPCaptureFrame(TP_Context *context, uint8_t direction, TPStatus status, const TP_IOVec *parts, uint8_t count)
+{
+	TPCaptureInfo info =
+	{
+			.tick = context->driver.Tick(),
+			.direction = direction,
+			.address = ((const uint8_t *)parts[0].buffer)[2],
+			.status = (int8_t)status
+	};
+
+	context->capture.callback(context->capture.param, &info, parts, count);
+}
+
+bool TPSendFrame(TP_Context *context, const Frame *frame)
+{
+	uint16_t _size = TPGetSize(frame->size);
+
+	TP_IOVec vector[] =
+	{
+			{ .buffer = frame,       .size = TP_STARTING_FRAME_SIZE },
+			{ .buffer = frame->data, .size = _size },
+			{ .buffer = frame->crc,  .size = TP_CRC_SIZE }
+	};
+
+	return TPWriteAll(context, vector, sizeof(vector) / sizeof(vector[0]));
+}
+
+bool TPSendStagedFrame(TP_Context *context, const Frame *frame)
+{
+	uint16_t _size = TPGetSize(frame->size);
+	uint8_t *buffer = context->tx.buffer;
+	uint8_t *crcField = &buffer[TP_STARTING_FRAME_SIZE + _size];
+	uint32_t frameSize = TP_STARTING_FRAME_SIZE + _size + TP_CRC_SIZE;
+	uint16_t crc = 0;
+
+	memcpy(buffer, frame, TP_STARTING_FRAME_SIZE);
+
+	crc = TP_CRC16(buffer, TP_STARTING_FRAME_SIZE);
+	crc = TP_CRC16Copy(&buffer[TP_STARTING_FRAME_SIZE], frame->data, _size, crc);
+
+	SET_LITTLE_ENDIAN_INT16(~crc, crcField);
+
+	TP_IOVec vector = { .buffer = buffer, .size = frameSize };
+
+	return TPWriteAll(context, &vector, 1);
+}
+
 //static uint16_t TPSum(uint16_t start, const void * data, uint32_t size)
 //{
 //	for(int i = 0; i < size; i++)
@@ -44,24 +406,12 @@ bool TPSendFrame(TP_Context *context, const Frame *frame)
 //	return start;
 //}
 
-bool TPIsValidCRC(const Frame *frame)
+bool TPIsExpectedCRC(uint16_t crc, const uint8_t *received)
 {
-	uint16_t _size = TPGetSize(frame->size);
-
-	uint16_t crc = 0;
-
-//	crc = TPSum(crc, frame, TP_STARTING_FRAME_SIZE);
-	crc = TP_CRC16((uint8_t *)frame, TP_STARTING_FRAME_SIZE);
-//	crc = TPSum(crc, frame->data, _size);
-	crc = TP_CRC16Add((uint8_t *)frame->data, _size, crc);
-
 	crc = ~crc;
-	uint16_t _crc = GET_LITTLE_ENDIAN_INT16(frame->crc);
-	/* Checar os valores de CRC */
-	if(crc == _crc)
-		return true;
+	uint16_t _crc = GET_LITTLE_ENDIAN_INT16(received);
 
-	return false;
+	return crc == _crc;
 }
 
 
@@ -91,6 +441,106 @@ void TPParseArrayToFrame(Frame *frame, uint8_t *array)
 }
 
 
+uint32_t TPReadSource(TP_Context *context, void *buffer, uint32_t size)
+{
+	TPRxBuffer *rx = &context->rx;
+
+	if(rx->feed != NULL)
+	{
+		uint32_t count = (rx->feedLength < size) ? rx->feedLength : size;
+
+		memcpy(buffer, rx->feed, count);
+		rx->feed += count;
+		rx->feedLength -= count;
+
+		return count;
+	}
+
+	return context->driver.Read(context->control.handle, buffer, size);
+}
+
+uint16_t TPFill(TP_Context *context)
+{
+	TPRxBuffer *rx = &context->rx;
+	uint16_t pending = rx->tail - rx->head;
+	uint16_t count = 0;
+
+	memmove(rx->data, &rx->data[rx->head], pending);
+	rx->head = 0;
+	rx->tail = pending;
+
+	count = TPReadSource(context, &rx->data[pending], TP_RX_CHUNK_SIZE - pending);
+	rx->tail += count;
+	rx->dry = (count == 0);
+
+	return count;
+}
+
+uint32_t TPRead(TP_Context *context, void *buffer, uint32_t size)
+{
+	TPRxBuffer *rx = &context->rx;
+	uint16_t count = rx->tail - rx->head;
+
+	if(count == 0)
+	{
+		rx->head = 0;
+		rx->tail = 0;
+
+		/* Large reads go straight to the destination */
+		if(size >= TP_RX_CHUNK_SIZE)
+		{
+			uint32_t read = TPReadSource(context, buffer, size);
+
+			rx->dry = (read == 0);
+			return read;
+		}
+
+		count = TPFill(context);
+	}
+
+	count = (count < size) ? count : size;
+	memcpy(buffer, &rx->data[rx->head], count);
+	rx->head += count;
+
+	return count;
+}
+
+void TPFlush(TP_Context *context)
+{
+	context->rx.head = 0;
+	context->rx.tail = 0;
+
+	context->driver.Flush(context->control.handle);
+}
+
+bool TPAcquireSlot(TP_Context *context)
+{
+	TPRxSlots *slots = &context->slots;
+
+	if(slots->count > 1)
+	{
+		if(TP_ATOMIC_LOAD(&slots->owned) & (1UL << slots->current))
+		{
+			return false;
+		}
+
+		context->response.data = &slots->base[slots->current * slots->size];
+	}
+
+	return true;
+}
+
+void TPHoldSlot(TP_Context *context)
+{
+	TPRxSlots *slots = &context->slots;
+
+	if(slots->count > 1)
+	{
+		TP_ATOMIC_OR(&slots->owned, 1UL << slots->current);
+		slots->current = (slots->current + 1) % slots->count;
+	}
+}
+
 bool TPIsTimeout(TP_Context *context)
 {
 	uint32_t currentTime = 0;
@@ -106,3 +556,36 @@ bool TPIsTimeout(TP_Context *context)
 
 	return false;
 }
+
+void TPCheckStarvation(TP_Context *context)
+{
+	if(context->control.nonBlocking == true)
+	{
+		/* Only the driver running dry means starving, the staging area may just have been consumed */
+		if((context->driver.capabilities & TP_DRIVER_DATAGRAM) || context->rx.dry == true)
+		{
+			context->control.status = TPIsRunning;
+
+			/* A frame abandoned by the peer would otherwise stay partial forever */
+			if(context->control.bytesRead != 0 && TPIsTimeout(context) == true)
+			{
+				TPResetContext(context);
+
+				context->control.status = TPTimeout;
+			}
+		}
+	}
+	else if(TPIsTimeout(context) == true)
+	{
+		TPLog(TPTimeout, "Timeout");
+
+		TPResetContext(context);
+
+		context->control.status = TPTimeout;
+	}
+	else if(context->driver.Wait != NULL)
+	{
+		/* Sleeps in the driver instead of spinning on Read and Tick */
+		context->driver.Wait(context->control.handle, context->control.timeout + context->control.timeoutConfig + 1);
+	}
+}
@@ -30,8 +30,12 @@
 #define TP_CRC_IntToArray(TPValue, TPArray)	(TPArray[0] = TPValue >> 8; TPArray[1] = TPValue & 0xFF)
 #define TPGetSize(TPSize)	                (uint16_t)((TP_ArrayToInt16(TPSize)))
 
+#define TPRxPending(context)                ((context)->rx.tail - (context)->rx.head)
+
 #define TP_ASSERT(test)	                    if(test) goto end
 
+#define TP_PARTS_MAX                        4	/*!< Parts of a payload given to TPSendParts */
+
 
 /*!
  * @internal
@@ -43,6 +47,124 @@
  */
 bool TPIsWriteCommand(uint8_t value);
 
+/*!
+ * @internal
+ * Sends a frame whose header and payload are set, through the TX staging area
+ * when it fits, otherwise in three writes.
+ *
+ * @param context Current context.
+ * @param frame   Frame to be sent, its CRC is calculated here.
+ * @return Returns true if the frame was written or false otherwise.
+ */
+bool TPSend(TP_Context *context, Frame *frame);
+
+/*!
+ * @internal
+ * Sends a frame whose payload is the concatenation of parts, e.g. a header and
+ * the application data. They are hashed while copied to the TX staging area
+ * when it fits, otherwise written with the frame header and CRC at once.
+ *
+ * @param context Current context.
+ * @param address Destination address.
+ * @param parts   Parts of the payload, up to TP_PARTS_MAX.
+ * @param count   Amount of parts.
+ * @return Returns true if the frame was written or false otherwise.
+ */
+bool TPSendParts(TP_Context *context, uint8_t address, const TP_IOVec *parts, uint8_t count);
+
+/*!
+ * @internal
+ * Writes the header of a frame, the jumbo one for payloads above 65535 bytes,
+ * followed by its CRC8 with TP_OPTION_HEADER_CHECK.
+ * @param context Current context.
+ * @param address Destination address.
+ * @param size    Payload size.
+ * @param header  Destination, TP_HEADER_MAX_SIZE bytes.
+ * @return Header size, or 0 if the payload needs a jumbo frame and TP_OPTION_JUMBO is not set.
+ */
+uint8_t TPEncodeHeader(TP_Context *context, uint8_t address, uint32_t size, uint8_t *header);
+
+/*!
+ * @internal
+ * Size of the header which starts with a STX, given the options of the context.
+ * @param context Current context.
+ * @param stx     First two bytes of the header.
+ * @return Header size, or 0 if it isn't a STX or is a jumbo one not enabled.
+ */
+uint8_t TPHeaderSize(TP_Context *context, const uint8_t *stx);
+
+/*!
+ * @internal
+ * Decodes a received header of control.headerSize bytes into control.payloadSize
+ * and response.address.
+ * @param context Current context.
+ * @param header  Header received.
+ * @return Returns false if TP_OPTION_HEADER_CHECK is set and its CRC8 doesn't match.
+ */
+bool TPDecodeHeader(TP_Context *context, const uint8_t *header);
+
+/*!
+ * @internal
+ * Hands a received payload to the application callback, or to the reassembly
+ * when fragmentation is enabled. A payload in the current RX slot keeps the
+ * slot until TP_Release.
+ *
+ * @param context Current context.
+ * @param address Address of the frame.
+ * @param payload Payload received.
+ * @param size    Payload size.
+ */
+void TPDeliver(TP_Context *context, uint8_t address, uint8_t *payload, uint32_t size);
+
+/*!
+ * @internal
+ * Calls the application callback, timing it in TPHistograms::callbackTime when set.
+ * @param context Current context.
+ * @param address Address of the frame.
+ * @param size    Payload size.
+ * @param payload Payload received.
+ */
+void TPCallback(TP_Context *context, uint8_t address, uint32_t size, uint8_t *payload);
+
+/*!
+ * @internal
+ * Adds a value to a histogram of TP_HISTOGRAM_BUCKETS log2 buckets.
+ * @param histogram Histogram.
+ * @param value     Value, usually in ticks.
+ */
+void TPHistogramAdd(uint32_t *histogram, uint32_t value);
+
+/*!
+ * @internal
+ * Updates the counters with the status of a frame just finished.
+ * @param context Current context.
+ */
+void TPCountFrame(TP_Context *context);
+
+/*!
+ * @internal
+ * Hands a frame to the capture callback set by TP_SetCapture, which must be set.
+ * @param context   Current context.
+ * @param direction TP_CAPTURE_RX or TP_CAPTURE_TX.
+ * @param status    Verdict of the frame.
+ * @param parts     Parts of the whole frame, starting by its header.
+ * @param count     Amount of parts.
+ */
+void TPCaptureFrame(TP_Context *context, uint8_t direction, TPStatus status, const TP_IOVec *parts, uint8_t count);
+
+/*!
+ * @internal
+ * Writes all the buffers, with TP_Driver::WriteV when available, resuming after
+ * short writes until the timeout expires without progress. The frame is captured
+ * once written or failed.
+ *
+ * @param context Current context.
+ * @param vector  Buffers to be written, updated as they are consumed.
+ * @param count   Amount of buffers.
+ * @return Returns true if everything was written or false otherwise.
+ */
+bool TPWriteAll(TP_Context *context, TP_IOVec *vector, uint8_t count);
+
 /*!
  * @internal
  * Metodo auxiliar para envio do comando solicitado.
@@ -54,12 +176,24 @@ bool TPSendFrame(TP_Context *context, const Frame *frame);
 
 /*!
  * @internal
- * Funcao para verificar se o comando/resposta esta integro.
+ * Builds the whole frame in the TX staging area, hashing the payload while it is
+ * copied, and sends it with a single write.
  *
- * @param Referencia do comando/resposta para verificacao.
- * @return Retorna true se for valido ou false caso contrario.
+ * @param context Context with the TX staging area set.
+ * @param frame   Frame with header and payload, the crc field is not used.
+ * @return Returns true on success or false otherwise.
  */
-bool TPIsValidCRC(const Frame *frame);
+bool TPSendStagedFrame(TP_Context *context, const Frame *frame);
+
+/*!
+ * @internal
+ * Compares a CRC accumulated while receiving against the one carried by the frame.
+ *
+ * @param crc      Running CRC16 of the header and payload.
+ * @param received CRC field of the frame.
+ * @return Returns true if they match or false otherwise.
+ */
+bool TPIsExpectedCRC(uint16_t crc, const uint8_t *received);
 
 /*!
  * @internal
@@ -77,6 +211,64 @@ void TPParseArrayToFrame(Frame *frame, uint8_t *array);
  */
 void TPCalculateCRC(Frame *frame);
 
+/*!
+ * @internal
+ * Reads from the RX staging area, refilling it with as much as the driver has
+ * when it is empty. Reads of a chunk or more go straight to the destination.
+ *
+ * @param context Current context.
+ * @param buffer  Destination.
+ * @param size    Maximum amount of data.
+ * @return Amount of data read.
+ */
+uint32_t TPRead(TP_Context *context, void *buffer, uint32_t size);
+
+/*!
+ * @internal
+ * Reads from the bytes given to TP_Feed while there is a call in progress,
+ * otherwise from the driver.
+ * @param context Current context.
+ * @param buffer  Destination.
+ * @param size    Maximum amount of data.
+ * @return Amount of data read.
+ */
+uint32_t TPReadSource(TP_Context *context, void *buffer, uint32_t size);
+
+/*!
+ * @internal
+ * Moves the pending bytes to the start of the RX staging area and reads as much
+ * as fits after them.
+ *
+ * @param context Current context.
+ * @return Amount of data read from the driver.
+ */
+uint16_t TPFill(TP_Context *context);
+
+/*!
+ * @internal
+ * Discards the bytes in the RX staging area and flushes the driver.
+ *
+ * @param context Current context.
+ */
+void TPFlush(TP_Context *context);
+
+/*!
+ * @internal
+ * Points the payload of the next frame to the current RX slot.
+ *
+ * @param context Current context.
+ * @return Returns false if the slot is still owned by the application.
+ */
+bool TPAcquireSlot(TP_Context *context);
+
+/*!
+ * @internal
+ * Hands the current RX slot to the application and moves to the next one.
+ *
+ * @param context Current context.
+ */
+void TPHoldSlot(TP_Context *context);
+
 /*!
  * @internal
  *
@@ -85,5 +277,17 @@ void TPCalculateCRC(Frame *frame);
  */
 bool TPIsTimeout(TP_Context *context);
 
+/*!
+ * @internal
+ * Called by a state which ran out of bytes. In non blocking mode, when the last read
+ * from the driver returned nothing, the state is kept and the status is TPIsRunning, so the
+ * frame is resumed by the next call, unless it started longer than the timeout ago;
+ * otherwise the frame is discarded with TPTimeout once the timeout expires and,
+ * until then, TP_Driver::Wait is used when available.
+ *
+ * @param context Current context.
+ */
+void TPCheckStarvation(TP_Context *context);
+
 
 #endif /* TPHELPER_H_ */
@@ -0,0 +1,122 @@
+/**
+ * @file    Scan.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#include <string.h>
+
+#include "Scan.h"
+#include "../Type/Frame.h"
+
+#if TP_SCAN_SIMD
+#include <immintrin.h>
+
+#define TP_SSE2_TARGET __attribute__ ((target ("sse2")))
+#define TP_AVX2_TARGET __attribute__ ((target ("avx2")))
+#endif
+
+static uint16_t TPScanSTXScalar(const uint8_t *data, uint16_t offset, uint16_t length)
+{
+	while(offset < length)
+	{
+		const uint8_t *found = memchr(&data[offset], TP_STX[0], length - offset);
+		if(found == NULL)
+		{
+			return length;
+		}
+
+		offset = (uint16_t)(found - data);
+		if(offset + 1 == length || data[offset + 1] == TP_STX[1] || data[offset + 1] == TP_STX_JUMBO[1])
+		{
+			return offset;
+		}
+		offset++;
+	}
+
+	return length;
+}
+
+#if TP_SCAN_SIMD
+/* Each lane compares data[i] with the first STX byte and data[i + 1] with the second one of both variants */
+TP_SSE2_TARGET static uint16_t TPScanSTXSSE2(const uint8_t *data, uint16_t length)
+{
+	const __m128i first = _mm_set1_epi8((char)TP_STX[0]);
+	const __m128i second = _mm_set1_epi8((char)TP_STX[1]);
+	const __m128i jumbo = _mm_set1_epi8((char)TP_STX_JUMBO[1]);
+	uint16_t offset = 0;
+
+	for(; offset + 17 <= length; offset += 16)
+	{
+		__m128i current = _mm_loadu_si128((const __m128i *)&data[offset]);
+		__m128i next = _mm_loadu_si128((const __m128i *)&data[offset + 1]);
+		__m128i follows = _mm_or_si128(_mm_cmpeq_epi8(next, second), _mm_cmpeq_epi8(next, jumbo));
+		uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(current, first), follows));
+
+		if(mask != 0)
+		{
+			return offset + (uint16_t)__builtin_ctz(mask);
+		}
+	}
+
+	return TPScanSTXScalar(data, offset, length);
+}
+
+TP_AVX2_TARGET static uint16_t TPScanSTXAVX2(const uint8_t *data, uint16_t length)
+{
+	const __m256i first = _mm256_set1_epi8((char)TP_STX[0]);
+	const __m256i second = _mm256_set1_epi8((char)TP_STX[1]);
+	const __m256i jumbo = _mm256_set1_epi8((char)TP_STX_JUMBO[1]);
+	uint16_t offset = 0;
+
+	for(; offset + 33 <= length; offset += 32)
+	{
+		__m256i current = _mm256_loadu_si256((const __m256i *)&data[offset]);
+		__m256i next = _mm256_loadu_si256((const __m256i *)&data[offset + 1]);
+		__m256i follows = _mm256_or_si256(_mm256_cmpeq_epi8(next, second), _mm256_cmpeq_epi8(next, jumbo));
+		uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(current, first), follows));
+
+		if(mask != 0)
+		{
+			return offset + (uint16_t)__builtin_ctz(mask);
+		}
+	}
+
+	return offset + TPScanSTXSSE2(&data[offset], length - offset);
+}
+#endif
+
+uint16_t TPScanSTX(const uint8_t *data, uint16_t length)
+{
+#if TP_SCAN_SIMD
+	static uint16_t (*scan)(const uint8_t *data, uint16_t length) = NULL;
+
+	if(scan == NULL)
+	{
+		__builtin_cpu_init();
+		if(__builtin_cpu_supports("avx2"))
+		{
+			scan = TPScanSTXAVX2;
+		}
+		else if(__builtin_cpu_supports("sse2"))
+		{
+			scan = TPScanSTXSSE2;
+		}
+		else
+		{
+			return TPScanSTXScalar(data, 0, length);
+		}
+	}
+
+	return scan(data, length);
+#else
+	return TPScanSTXScalar(data, 0, length);
+#endif
+}
@@ -0,0 +1,33 @@
+/**
+ * @file    Scan.h
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Search of the STX sync word used to resynchronize the parser.
+ */
+
+#ifndef TPSCAN_H_
+#define TPSCAN_H_
+
+#include "../Settings.h"
+
+/*!
+ * @internal
+ * Finds the first STX candidate in a buffer: a 0x5A followed by 0x55 or by 0x56,
+ * the jumbo frame STX, or a 0x5A which is the last byte of the buffer.
+ *
+ * Uses AVX2 or SSE2 when the CPU supports them, otherwise memchr.
+ *
+ * @param data   Bytes received.
+ * @param length Amount of bytes.
+ * @return Offset of the candidate, or length if there is none.
+ */
+uint16_t TPScanSTX(const uint8_t *data, uint16_t length);
+
+#endif /* TPSCAN_H_ */
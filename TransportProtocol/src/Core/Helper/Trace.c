@@ -0,0 +1,89 @@
+/**
+ * @file    Trace.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#include "Trace.h"
+#include "../States/State.h"
+
+static uint8_t TPTraceStateId(ITPState state)
+{
+	static const struct
+	{
+		ITPState state;
+		uint8_t id;
+	} states[] =
+	{
+			{ NULL,                  TP_TRACE_NONE },
+			{ TPIdleState,           TP_TRACE_IDLE },
+			{ TPStartingFrameState,  TP_TRACE_STARTING_FRAME },
+			{ TPPayloadState,        TP_TRACE_PAYLOAD },
+			{ TPChecksumState,       TP_TRACE_CHECKSUM },
+			{ TPNAKRequestState,     TP_TRACE_NAK_REQUEST },
+			{ TPNAKResponseState,    TP_TRACE_NAK_RESPONSE },
+			{ TPDatagramState,       TP_TRACE_DATAGRAM }
+	};
+
+	for(uint8_t i = 0; i < sizeof(states) / sizeof(states[0]); i++)
+	{
+		if(states[i].state == state)
+		{
+			return states[i].id;
+		}
+	}
+
+	return TP_TRACE_UNKNOWN;
+}
+
+void TPTraceWrite(TP_Context *context, ITPState from)
+{
+	TPTrace *trace = &context->trace;
+	TPTraceRecord *record = &trace->records[trace->head & trace->mask];
+
+	record->tick = context->driver.Tick();
+	record->bytesRead = context->control.bytesRead;
+	record->from = TPTraceStateId(from);
+	record->to = TPTraceStateId(context->state);
+	record->status = (int8_t)context->control.status;
+	record->reserved = 0;
+
+	/* Published after the record is complete */
+	TP_ATOMIC_STORE(&trace->head, trace->head + 1);
+}
+
+uint32_t TPTraceRead(TP_Context *context, TPTraceRecord *records, uint32_t count)
+{
+	TPTrace *trace = &context->trace;
+	uint32_t size = trace->mask + 1;
+	uint32_t head = TP_ATOMIC_LOAD(&trace->head);
+	uint32_t available = (head < size) ? head : size;
+	uint32_t first = 0;
+	uint32_t lost = 0;
+
+	available = (available < count) ? available : count;
+	first = head - available;
+
+	for(uint32_t i = 0; i < available; i++)
+	{
+		records[i] = trace->records[(first + i) & trace->mask];
+	}
+
+	/* The writer went on meanwhile, the slot it may be writing included */
+	head = TP_ATOMIC_LOAD(&trace->head) + 1;
+	if(head - first > size)
+	{
+		lost = head - first - size;
+		lost = (lost < available) ? lost : available;
+		memmove(records, &records[lost], (available - lost) * sizeof(TPTraceRecord));
+	}
+
+	return available - lost;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file    Trace.h
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Binary tracing of the parser state machine into the ring given by TP_SetTrace.
+ * One TPTraceRecord is written each time a state hands over to another one or
+ * starves, by the thread running the parser only; TP_GetTrace may copy the ring
+ * from any thread. tools/TraceDump.py decodes the records.
+ */
+
+#ifndef TPTRACE_H_
+#define TPTRACE_H_
+
+#include "../Type/Context.h"
+
+/* State ids of TPTraceRecord, also known by tools/TraceDump.py */
+#define TP_TRACE_NONE			0	/*!< Frame finished */
+#define TP_TRACE_IDLE			1
+#define TP_TRACE_STARTING_FRAME	2
+#define TP_TRACE_PAYLOAD		3
+#define TP_TRACE_CHECKSUM		4
+#define TP_TRACE_NAK_REQUEST	5
+#define TP_TRACE_NAK_RESPONSE	6
+#define TP_TRACE_DATAGRAM		7
+#define TP_TRACE_UNKNOWN		0xFF
+
+#if TP_TRACE
+	#define TPTraceState(context, from)	\
+		do { \
+			if((context)->trace.records != NULL && ((context)->state != (from) || (context)->control.status == TPIsRunning)) \
+				TPTraceWrite(context, from); \
+		} while(0)
+#else
+	#define TPTraceState(context, from)	(void) (from)
+#endif
+
+/*!
+ * @internal
+ * Writes a record of the state which just ran.
+ *
+ * @param context Current context.
+ * @param from    State which ran, context->state is the next one.
+ */
+void TPTraceWrite(TP_Context *context, ITPState from);
+
+/*!
+ * @internal
+ * Copies the newest records of the ring, oldest first. Records overwritten while
+ * they were copied are left out, and so is the oldest one once the ring wrapped,
+ * since the writer may be in the middle of it.
+ *
+ * @param context Current context.
+ * @param records Destination.
+ * @param count   Maximum amount of records.
+ * @return Amount of records copied.
+ */
+uint32_t TPTraceRead(TP_Context *context, TPTraceRecord *records, uint32_t count);
+
+#endif /* TPTRACE_H_ */
@@ -38,6 +38,104 @@
 #define TP_TRIALS_AMOUNT	  	3
 #define TP_BUFFER_SIZE		  	(uint32_t)(1 * 1024)
 #define TP_PARAMETER_SIZE		2
+#ifndef TP_RX_CHUNK_SIZE
+	#define TP_RX_CHUNK_SIZE	128		/*!< Staging area filled by each driver read, part of every TP_Context */
+#endif
+
+#if TP_RX_CHUNK_SIZE > UINT16_MAX
+	#error "TP_RX_CHUNK_SIZE must fit the uint16_t head and tail of TPRxBuffer"
+#endif
+
+/*
+ * CRC engines selectable at build time, e.g. -DTP_CRC16_ENGINE=TP_CRC_BYTE_TABLE.
+ * The slicing engines trade table memory for speed: every slice is 512 bytes on CRC16 and 1 KiB
+ * on CRC32, so CRC16 slicing-8 takes 4 KiB and CRC32 slicing-16 takes 16 KiB, against 512 bytes
+ * and 1 KiB for the byte tables. Cortex-M3 defaults to the byte tables to keep the flash.
+ */
+#define TP_CRC_BYTE_TABLE		1
+#define TP_CRC_SLICING_8		8
+#define TP_CRC_SLICING_16		16
+
+#if defined __ARM_ARCH_7M__
+	#define TP_CRC_DEFAULT_ENGINE	TP_CRC_BYTE_TABLE
+#endif
+
+#ifndef TP_CRC16_ENGINE
+	#if defined TP_CRC_DEFAULT_ENGINE
+		#define TP_CRC16_ENGINE		TP_CRC_DEFAULT_ENGINE
+	#else
+		#define TP_CRC16_ENGINE		TP_CRC_SLICING_8
+	#endif
+#endif
+
+#ifndef TP_CRC32_ENGINE
+	#if defined TP_CRC_DEFAULT_ENGINE
+		#define TP_CRC32_ENGINE		TP_CRC_DEFAULT_ENGINE
+	#else
+		#define TP_CRC32_ENGINE		TP_CRC_SLICING_16
+	#endif
+#endif
+
+/*
+ * Carry-less multiply (PCLMULQDQ) folding, used when CPUID reports it at runtime.
+ * Buffers shorter than TP_CRC_CLMUL_THRESHOLD bytes always go through the tables.
+ */
+#ifndef TP_CRC_CLMUL
+	#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+		#define TP_CRC_CLMUL	1
+	#else
+		#define TP_CRC_CLMUL	0
+	#endif
+#endif
+
+#define TP_CRC_CLMUL_THRESHOLD	64
+
+/* SSE2/AVX2 search of the STX while resynchronizing, chosen at runtime */
+#ifndef TP_SCAN_SIMD
+	#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+		#define TP_SCAN_SIMD	1
+	#else
+		#define TP_SCAN_SIMD	0
+	#endif
+#endif
+
+/* Payload slots of TP_SetRxSlots, one bit each in the ownership mask */
+#define TP_RX_SLOTS_MAX			32
+
+/*
+ * Ownership of the RX slots is shared by the parser and the thread releasing them,
+ * and the loopback clock by every thread running a loopback link.
+ * Without the GCC builtins the plain accesses are only safe on single core targets
+ * where TP_Release isn't called from an interrupt.
+ */
+#if defined __GNUC__
+	#define TP_ATOMIC_LOAD(ptr)			__atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+	#define TP_ATOMIC_OR(ptr, value)	__atomic_fetch_or(ptr, value, __ATOMIC_ACQ_REL)
+	#define TP_ATOMIC_AND(ptr, value)	__atomic_fetch_and(ptr, value, __ATOMIC_ACQ_REL)
+	#define TP_ATOMIC_ADD(ptr, value)	__atomic_fetch_add(ptr, value, __ATOMIC_RELAXED)
+	#define TP_ATOMIC_STORE(ptr, value)	__atomic_store_n(ptr, value, __ATOMIC_RELEASE)
+#else
+	#define TP_ATOMIC_LOAD(ptr)			(*(volatile uint32_t *)(ptr))
+	#define TP_ATOMIC_OR(ptr, value)	(*(volatile uint32_t *)(ptr) |= (value))
+	#define TP_ATOMIC_AND(ptr, value)	(*(volatile uint32_t *)(ptr) &= (value))
+	#define TP_ATOMIC_ADD(ptr, value)	((*(volatile uint32_t *)(ptr) += (value)) - (value))
+	#define TP_ATOMIC_STORE(ptr, value)	(*(volatile uint32_t *)(ptr) = (value))
+#endif
+
+/* Frames in flight of the reliable mode, one bit each in the acknowledgement masks */
+#define TP_ARQ_WINDOW_MAX		32
+
+/* epoll reactor: events taken per wait and frames parsed per link before moving to the next one */
+#define TP_REACTOR_EVENTS		64
+#define TP_REACTOR_BUDGET		16
+
+/* Buckets of the tick histograms of TP_SetHistograms, bucket n counts values below 2^n and the last one the rest */
+#define TP_HISTOGRAM_BUCKETS	16
+
+/* Tracepoints of the parser state machine, recorded once TP_SetTrace gives a ring; 0 compiles them out */
+#ifndef TP_TRACE
+	#define TP_TRACE			1
+#endif
 
 #define SET_BIG_ENDIAN_INT16(_x, array) array[0] = (_x >> 8) & 0xFF; array[1] = (_x >> 0) & 0xFF
 #define SET_LITTLE_ENDIAN_INT16(_x, array) array[1] = (_x >> 8) & 0xFF; array[0] = (_x >> 0) & 0xFF
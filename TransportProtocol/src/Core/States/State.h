@@ -75,5 +75,22 @@ void TPServerChecksumState(TP_Context *context);
 
 void TPChecksumState(TP_Context *context);
 
+/*!
+ * Checks the CRC of a frame fully received and hands it to the application or,
+ * in the reliable mode, to TPNAKRequestState or TPNAKResponseState, which expect
+ * the payload at response.data.
+ *
+ * @param context Current context of the TP protocol communication.
+ * @param payload Payload received.
+ */
+void TPFrameReceived(TP_Context *context, uint8_t *payload);
+
+/*!
+ * Receives a whole frame with a single read, for drivers with TP_DRIVER_DATAGRAM.
+ *
+ * @param context Current context of the TP protocol communication.
+ */
+void TPDatagramState(TP_Context *context);
+
 
 #endif /* TPSTATE_H_ */
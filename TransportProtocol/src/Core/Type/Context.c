@@ -28,4 +28,6 @@ void TPResetContext(TP_Context *context)
 	context->control.size = size;
 	context->control.maxPayloadSize = maxPayload;
 	context->control.timeoutConfig = timeout;
+
+	context->state = NULL;
 }
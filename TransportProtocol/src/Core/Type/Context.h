@@ -22,20 +22,149 @@
 #include "Frame.h"
 #include "Status.h"
 
-typedef void (*ITPCallback)(void *param, uint8_t address, uint16_t size, uint8_t *payload);
+#define TP_OPTION_STREAMING		0x00000001	/*!< TP_Process delivers every complete frame available, not only the first one */
+#define TP_OPTION_JUMBO			0x00000002	/*!< Payloads above 65535 bytes are sent in jumbo frames, which are also accepted */
+#define TP_OPTION_HEADER_CHECK	0x00000004	/*!< Headers carry a CRC8, a corrupted one is dropped without waiting for its payload */
+
+#define TP_CAPTURE_RX			0			/*!< Frame received, see TPCaptureInfo */
+#define TP_CAPTURE_TX			1			/*!< Frame sent */
+
+typedef void (*ITPCallback)(void *param, uint8_t address, uint32_t size, uint8_t *payload);
+
+typedef struct TPCaptureInfo
+{
+	uint32_t tick;							/*!< TP_Driver::Tick when the frame was finished */
+	uint8_t direction;						/*!< TP_CAPTURE_RX or TP_CAPTURE_TX */
+	uint8_t address;						/*!< Address of the frame */
+	int8_t status;							/*!< TPSuccess or TPErrorChecksum when received, TPSuccess, TPErrorSending or TPTimeout when sent */
+} TPCaptureInfo;
+
+/*!
+ * Receives each frame captured, as the parts which make up the whole frame on the
+ * wire, header and CRC included. It runs in the thread receiving or sending it, so
+ * it should only copy the frame, e.g. tools/Pcapng.c.
+ */
+typedef void (*ITPCapture)(void *param, const TPCaptureInfo *info, const TP_IOVec *parts, uint8_t count);
 
 typedef struct TPControl
 {
 	void *handle;
 	uint32_t timeoutConfig;
 	uint32_t timeout;
+	uint32_t started;						/*!< Tick of the STX of the frame being received */
 	uint32_t bytesRead;
 	uint8_t trialsAmount;
 	uint32_t size;	             			/*!< Maximum payload size */
 	uint32_t maxPayloadSize;				/*!< Maximum payload size */
+	uint16_t crc;							/*!< Running CRC16 of the frame being received */
+	uint8_t header[TP_HEADER_MAX_SIZE];		/*!< Header of the frame being received */
+	uint8_t headerSize;						/*!< Header size, it depends on the STX */
+	uint32_t payloadSize;					/*!< Payload size decoded from the header */
+	bool nonBlocking;						/*!< Starving states return TPIsRunning instead of waiting for the timeout */
 	TPStatus status;
 } TPControl;
 
+typedef struct TPRxBuffer
+{
+	uint16_t head;							/*!< Next byte to be parsed */
+	uint16_t tail;							/*!< End of the bytes read from the driver */
+	uint8_t data[TP_RX_CHUNK_SIZE];			/*!< Bytes read ahead, kept across frames */
+	const uint8_t *feed;					/*!< Bytes given to TP_Feed not parsed yet, NULL reads from the driver */
+	uint32_t feedLength;					/*!< Amount of bytes left in feed */
+	bool dry;								/*!< The last read from the driver or the feed returned nothing */
+} TPRxBuffer;
+
+typedef struct TPRxSlots
+{
+	uint8_t *base;							/*!< Payload area given to TP_Init */
+	uint32_t size;							/*!< Size of each slot */
+	uint8_t count;							/*!< Amount of slots, ownership is only tracked above one */
+	uint8_t current;						/*!< Slot filled by the parser */
+	uint32_t owned;							/*!< Slots delivered and not released yet, one bit each */
+} TPRxSlots;
+
+typedef struct TPArq
+{
+	uint8_t *buffer;						/*!< Send window followed by the reorder window, given by TP_SetArq */
+	uint32_t slotSize;						/*!< Size of each window slot */
+	uint32_t retransmitTimeout;				/*!< Ticks without acknowledgement before a frame is sent again */
+	uint8_t trials;							/*!< Transmissions of a frame without acknowledgement before the link is down */
+	uint8_t window;							/*!< Frames in flight, 0 disables the reliable mode */
+	uint8_t base;							/*!< Oldest frame not acknowledged */
+	uint8_t next;							/*!< Sequence of the next frame sent */
+	uint8_t expected;						/*!< Sequence of the next frame delivered */
+	uint8_t nakSequence;					/*!< Last frame requested with a NAK */
+	bool nakSent;							/*!< A NAK for nakSequence was already sent */
+	uint8_t baseIndex;						/*!< Slot of base in the send window */
+	uint8_t expectedIndex;					/*!< Slot of expected in the reorder window */
+	uint32_t acked;							/*!< Frames of the send window acknowledged, one bit per slot */
+	uint32_t received;						/*!< Frames held in the reorder window, one bit per slot */
+	TPStatus status;						/*!< TPTimeout while a frame in flight is out of trials */
+} TPArq;
+
+typedef struct TPFragment
+{
+	uint8_t *buffer;						/*!< Reassembly buffer given by TP_SetFragmentation, NULL disables it */
+	uint32_t size;							/*!< Reassembly buffer size */
+	uint32_t length;						/*!< Bytes of the payload reassembled so far */
+	uint16_t fragmentSize;					/*!< Largest frame payload sent, 0 disables fragmentation */
+	bool discarding;						/*!< A fragment was lost, the rest of the payload is dropped */
+} TPFragment;
+
+typedef struct TPCounters
+{
+	uint32_t skippedBytes;					/*!< Bytes discarded while looking for the STX */
+	uint32_t resyncs;						/*!< Times bytes had to be discarded to find the STX */
+	uint32_t badHeaders;					/*!< Headers dropped by TP_OPTION_HEADER_CHECK */
+	uint32_t framesReceived;				/*!< Frames received with a valid CRC */
+	uint64_t bytesReceived;					/*!< Payload bytes of the frames received */
+	uint32_t framesSent;					/*!< Frames written to the driver */
+	uint64_t bytesSent;						/*!< Bytes written to the driver, headers and CRCs included */
+	uint32_t crcErrors;						/*!< Frames dropped with TPErrorChecksum */
+	uint32_t overflows;						/*!< Frames dropped with TPBufferOverflow */
+	uint32_t frameErrors;					/*!< Frames dropped with TPFrameError */
+	uint32_t timeouts;						/*!< Frames dropped with TPTimeout */
+	uint32_t sendErrors;					/*!< Frames not written, TPErrorSending or TPTimeout */
+} TPCounters;
+
+typedef struct TPHistograms
+{
+	uint32_t receiveTime[TP_HISTOGRAM_BUCKETS];		/*!< Ticks from the STX to the end of each frame received */
+	uint32_t callbackTime[TP_HISTOGRAM_BUCKETS];	/*!< Ticks spent in each call of the callback */
+} TPHistograms;
+
+typedef struct TPTraceRecord
+{
+	uint32_t tick;							/*!< TP_Driver::Tick after the state ran */
+	uint32_t bytesRead;						/*!< Bytes of the frame received so far */
+	uint8_t from;							/*!< TP_TRACE_* id of the state which ran */
+	uint8_t to;								/*!< TP_TRACE_* id of the next state, from again when it starved */
+	int8_t status;							/*!< TPStatus after the state ran */
+	uint8_t reserved;
+} TPTraceRecord;
+
+typedef struct TPTrace
+{
+	TPTraceRecord *records;					/*!< Ring given by TP_SetTrace, NULL disables the tracing */
+	uint32_t mask;							/*!< Amount of records minus 1, it is a power of 2 */
+	uint32_t head;							/*!< Records written since TP_SetTrace, the next one goes to head & mask */
+} TPTrace;
+
+typedef struct TPCapture
+{
+	ITPCapture callback;					/*!< Given by TP_SetCapture, NULL disables the capture */
+	void *param;
+} TPCapture;
+
+typedef struct TPTxControl
+{
+	uint8_t *buffer;						/*!< Staging area where the whole frame is built, optional */
+	uint32_t size;							/*!< Staging area size */
+	uint32_t timeout;						/*!< Tick of the last write progress */
+	uint32_t bytesWritten;					/*!< Bytes of the frame being sent already written */
+	TPStatus status;						/*!< Result of the last frame sent */
+} TPTxControl;
+
 
 struct TP_Context
 {
@@ -44,6 +173,16 @@ struct TP_Context
 	Frame command;
 	Frame response;
 	TPControl control;
+	TPRxBuffer rx;
+	TPRxSlots slots;
+	TPTxControl tx;
+	TPArq arq;
+	TPFragment fragment;
+	TPCounters counters;
+	TPHistograms *histograms;				/*!< Given by TP_SetHistograms, NULL doesn't time frames nor callbacks */
+	TPTrace trace;
+	TPCapture capture;
+	uint32_t options;						/*!< TP_OPTION_* flags */
 	ITPCallback callback;
 	void *param;
 	ITPState state;
@@ -51,6 +190,7 @@ struct TP_Context
 
 /*!
  * Metodo para reinicializar os atributos de controle da maquina de estado do protocolo.
+ * Um quadro parcialmente recebido e descartado.
  *
  * @param context Referencia do contexto da comunicacao para reinicializacao.
  *
@@ -19,8 +19,29 @@
 
 #include "../Settings.h"
 
+/*!
+ * @brief Each TP_Driver::Read returns one whole datagram, which holds one frame,
+ * e.g. a UDP socket whose peer sends every frame with a single write. Frames are
+ * then validated in one step, without looking for the STX, and a RX slot must
+ * fit the header and CRC besides the payload.
+ */
+#define TP_DRIVER_DATAGRAM	0x00000001
+
+/*!
+ * @brief One buffer of a vectored write, see TP_Driver::WriteV.
+ */
+typedef struct
+{
+	const void *buffer;	/*!< Data to be send */
+	uint32_t size;		/*!< Amount of data */
+}TP_IOVec;
+
 /*!
  * @brief Callback struct to provide access to platform resources.
+ *
+ * @details Write may send less than requested, the remaining data is written by
+ * the following calls. Return 0 if nothing can be written now and a value
+ * greater than size, e.g. (uint32_t)-1, on error.
  */
 typedef struct
 {
@@ -42,7 +63,7 @@ typedef struct
 	 *
 	 * @return Amount of data written.
 	 */
-	uint16_t ( *Write)(void *handle, const void *buffer, uint16_t size);
+	uint32_t ( *Write)(void *handle, const void *buffer, uint32_t size);
 
 	/*!
 	 * @brief Read raw data from port opened by T_Driver::Open
@@ -53,7 +74,7 @@ typedef struct
 	 *
 	 * @return Amount of data read.
 	 */
-	uint16_t ( *Read )(void *handle, void *buffer, uint16_t size);
+	uint32_t ( *Read )(void *handle, void *buffer, uint32_t size);
 
 	/*!
 	 * @brief Close the port opened by T_Driver::Open
@@ -85,6 +106,39 @@ typedef struct
 	 * @param[in] time to sleep
 	 */
 	void (*Sleep) (uint32_t time);
+
+	/*!
+	 * @brief Optional. Write several buffers at once, e.g. with writev or sendmsg.
+	 *
+	 * @details Used to send header, payload and CRC in one call without copying the payload.
+	 * It follows the same partial write rules of TP_Driver::Write.
+	 *
+	 * @param[in] handle Returned by T_Driver::Open.
+	 * @param[in] vector Buffers to be send in order.
+	 * @param[in] count  Amount of buffers.
+	 *
+	 * @return Amount of data written.
+	 */
+	uint32_t (*WriteV)(void *handle, const TP_IOVec *vector, uint8_t count);
+
+	/*!
+	 * @brief Optional. Blocks until there are bytes to be read or the deadline passes,
+	 * e.g. with poll, select or an event flag set by the RX interrupt.
+	 *
+	 * @details Used while a frame is awaited instead of calling Read and Tick in a loop.
+	 * Returning earlier is harmless, the wait is repeated until the timeout.
+	 *
+	 * @param[in] handle   Returned by T_Driver::Open.
+	 * @param[in] deadline Time returned by T_Driver::Tick when the wait gives up.
+	 *
+	 * @return true if there may be bytes to be read.
+	 */
+	bool (*Wait)(void *handle, uint32_t deadline);
+
+	/*!
+	 * @brief TP_DRIVER_* flags, 0 for a byte stream.
+	 */
+	uint32_t capabilities;
 }TP_Driver;
 
 #endif /* TP_Driver_H_ */
@@ -36,6 +36,22 @@
  * |**Size**   |2      |3        |Size of the *Payload* from 1 to 65535 bytes.                |
  * |**Payload**|var    |5        |Content transported with the size specified by *size* field.|
  * |**Crc**    |2      |5 + Size |CRC16 calculated from stx byte to the last byte of payload. |
+ *
+ * @par Jumbo Frame
+ * Used for payloads above 65535 bytes when both ends set TP_OPTION_JUMBO, smaller
+ * payloads keep the frame above.
+ * | Field     | Sise  | Offset  | Description                                                |
+ * |:--:       |:--:   |:--:     |:--                                                         |
+ * |**Stx**    |2      |0        |0x5A56.                                                     |
+ * |**Address**|1      |2        |Same as above.                                              |
+ * |**Size**   |4      |3        |Size of the *Payload*, big endian.                          |
+ * |**Payload**|var    |7        |Content transported with the size specified by *size* field.|
+ * |**Crc**    |2      |7 + Size |CRC16 calculated from stx byte to the last byte of payload. |
+ *
+ * @par Header Check
+ * When both ends set TP_OPTION_HEADER_CHECK a CRC8 of the stx, address and size
+ * fields follows the size field of both frames above, moving the payload one byte.
+ * The CRC16 covers it too.
  * @}
  */
 
@@ -51,9 +67,13 @@ typedef struct
 #pragma pack(pop)
 
 static const uint8_t TP_STX[] = {0x5A, 0x55};
+static const uint8_t TP_STX_JUMBO[] = {0x5A, 0x56};
 
 #define TP_STX_SIZE	          	sizeof(TP_STX)
 #define TP_STARTING_FRAME_SIZE	(uintptr_t)(&(((Frame *)0)->data))
 #define TP_CRC_SIZE		  		sizeof(((Frame*)0)->crc)
+#define TP_JUMBO_HEADER_SIZE	7	/*!< Stx, address and the 4 bytes size of a jumbo frame */
+#define TP_HEADER_CHECK_SIZE	1	/*!< CRC8 of the header, see TP_OPTION_HEADER_CHECK */
+#define TP_HEADER_MAX_SIZE		(TP_JUMBO_HEADER_SIZE + TP_HEADER_CHECK_SIZE)
 
 #endif /* Frame_H_ */
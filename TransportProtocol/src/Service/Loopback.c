@@ -0,0 +1,167 @@
+/**
+ * @file   Loopback.c
+ * @author Douglas Reis
+ * @date   18/10/2026
+ */
+
+#include "Loopback.h"
+#include "../Core/Helper/Helper.h"
+
+/* Shared by every loopback link, which may be served from different threads */
+static uint32_t TPLoopbackTicks;
+
+static void *TPLoopbackOpen(const void *port)
+{
+	return (void *)port;
+}
+
+static uint16_t TPLoopbackClose(void *handle)
+{
+	return 0;
+}
+
+static uint32_t TPLoopbackWrite(void *handle, const void *buffer, uint32_t size)
+{
+	TP_LoopbackQueue *queue = ((TP_LoopbackEnd *)handle)->out;
+	uint32_t tail = queue->tail;
+	uint32_t space = queue->mask + 1 - (tail - TP_ATOMIC_LOAD(&queue->head));
+	uint32_t offset = tail & queue->mask;
+	uint32_t first = 0;
+
+	size = (size > space) ? space : size;
+	first = (size > queue->mask + 1 - offset) ? queue->mask + 1 - offset : size;
+
+	memcpy(&queue->data[offset], buffer, first);
+	memcpy(queue->data, (const uint8_t *)buffer + first, size - first);
+
+	/* Published after the bytes are in place */
+	TP_ATOMIC_STORE(&queue->tail, tail + size);
+
+	return size;
+}
+
+static uint32_t TPLoopbackWriteV(void *handle, const TP_IOVec *vector, uint8_t count)
+{
+	uint32_t written = 0;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		uint32_t size = TPLoopbackWrite(handle, vector[i].buffer, vector[i].size);
+
+		written += size;
+		if(size < vector[i].size)
+		{
+			break;
+		}
+	}
+
+	return written;
+}
+
+static uint32_t TPLoopbackRead(void *handle, void *buffer, uint32_t size)
+{
+	TP_LoopbackEnd *end = (TP_LoopbackEnd *)handle;
+	TP_LoopbackQueue *queue = end->in;
+	uint32_t head = queue->head;
+	uint32_t available = TP_ATOMIC_LOAD(&queue->tail) - head;
+	uint32_t offset = head & queue->mask;
+	uint32_t first = 0;
+
+	if(available == 0 && end->idle != NULL && end->idling == false)
+	{
+		end->idling = true;
+		end->idle(end->param);
+		end->idling = false;
+
+		available = TP_ATOMIC_LOAD(&queue->tail) - head;
+	}
+
+	size = (size > available) ? available : size;
+	first = (size > queue->mask + 1 - offset) ? queue->mask + 1 - offset : size;
+
+	memcpy(buffer, &queue->data[offset], first);
+	memcpy((uint8_t *)buffer + first, queue->data, size - first);
+
+	/* The space is given back after the bytes were copied */
+	TP_ATOMIC_STORE(&queue->head, head + size);
+
+	return size;
+}
+
+static void TPLoopbackFlush(void *handle)
+{
+	TP_LoopbackQueue *queue = ((TP_LoopbackEnd *)handle)->in;
+
+	TP_ATOMIC_STORE(&queue->head, TP_ATOMIC_LOAD(&queue->tail));
+}
+
+static uint32_t TPLoopbackTick(void)
+{
+	return TP_ATOMIC_ADD(&TPLoopbackTicks, 1);
+}
+
+static void TPLoopbackSleep(uint32_t time)
+{
+	TP_ATOMIC_ADD(&TPLoopbackTicks, time);
+}
+
+TP_Driver TP_LoopbackDriver =
+{
+		.Open = TPLoopbackOpen,
+		.Write = TPLoopbackWrite,
+		.Read = TPLoopbackRead,
+		.Close = TPLoopbackClose,
+		.Flush = TPLoopbackFlush,
+		.Tick = TPLoopbackTick,
+		.Sleep = TPLoopbackSleep,
+		.WriteV = TPLoopbackWriteV
+};
+
+bool TP_LoopbackInit(TP_Loopback *loopback, uint8_t *buffer, uint32_t size)
+{
+	uint32_t half = size / 2;
+
+	TP_ASSERT(loopback == NULL || buffer == NULL || half == 0 || (half & (half - 1)) != 0);
+
+	memset(loopback, 0, sizeof(TP_Loopback));
+
+	for(uint8_t i = 0; i < 2; i++)
+	{
+		loopback->queues[i].data = &buffer[i * half];
+		loopback->queues[i].mask = half - 1;
+	}
+
+	/* A writes to the first queue, B reads it */
+	loopback->ends[TP_LOOPBACK_A].out = &loopback->queues[0];
+	loopback->ends[TP_LOOPBACK_A].in = &loopback->queues[1];
+	loopback->ends[TP_LOOPBACK_B].out = &loopback->queues[1];
+	loopback->ends[TP_LOOPBACK_B].in = &loopback->queues[0];
+
+	return true;
+
+	end:
+	return false;
+}
+
+const void *TP_LoopbackPort(TP_Loopback *loopback, uint8_t side)
+{
+	TP_ASSERT(loopback == NULL || side > TP_LOOPBACK_B);
+
+	return &loopback->ends[side];
+
+	end:
+	return NULL;
+}
+
+bool TP_LoopbackSetIdle(TP_Loopback *loopback, uint8_t side, void (*idle)(void *param), void *param)
+{
+	TP_ASSERT(loopback == NULL || side > TP_LOOPBACK_B);
+
+	loopback->ends[side].idle = idle;
+	loopback->ends[side].param = param;
+
+	return true;
+
+	end:
+	return false;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file   Loopback.h
+ * @author Douglas Reis
+ * @date   18/10/2026
+ * @brief  TP_Driver connecting two links of the same process through memory.
+ * @private
+ * @internal
+ *
+ * Two byte queues, one each way, between the ends TP_LOOPBACK_A and
+ * TP_LOOPBACK_B. Each queue has a single writer and a single reader, so both
+ * ends may run in the same thread or each in its own one. Nothing is lost and
+ * nothing goes through the kernel, which leaves only the protocol costs to be
+ * measured, e.g. by make bench, or a link to be embedded in a simulator.
+ */
+
+#ifndef TPLOOPBACK_H_
+#define TPLOOPBACK_H_
+
+#include "Service.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TP_LOOPBACK_A		0
+#define TP_LOOPBACK_B		1
+
+typedef struct
+{
+	uint8_t *data;
+	uint32_t mask;					/*!< Queue size minus 1, a power of 2 */
+	uint32_t head;					/*!< Bytes read so far, moved by the reading end only */
+	uint32_t tail;					/*!< Bytes written so far, moved by the writing end only */
+}TP_LoopbackQueue;
+
+typedef struct
+{
+	TP_LoopbackQueue *in;
+	TP_LoopbackQueue *out;
+	void (*idle)(void *param);		/*!< Runs when a read finds nothing, see TP_LoopbackSetIdle */
+	void *param;
+	bool idling;
+}TP_LoopbackEnd;
+
+typedef struct
+{
+	TP_LoopbackQueue queues[2];
+	TP_LoopbackEnd ends[2];
+}TP_Loopback;
+
+/*!
+ * @internal
+ * @private
+ * @brief Driver of both ends, given to TP_Init with TP_LoopbackPort.
+ *
+ * Its Tick counts its own calls, so a link waiting for bytes which never come
+ * gives up after timeout calls instead of hanging; replace it with a clock when
+ * the ends run in different threads or the timeouts must be in real time.
+ */
+extern TP_Driver TP_LoopbackDriver;
+
+/*!
+ * @internal
+ * @private
+ * @brief Splits the buffer in the two queues, both empty.
+ *
+ * @param loopback
+ * @param buffer
+ * @param size Buffer size, twice a power of 2.
+ * @return
+ */
+bool TP_LoopbackInit(TP_Loopback *loopback, uint8_t *buffer, uint32_t size);
+
+/*!
+ * @internal
+ * @private
+ * @brief Port of one end, given to TP_Init, LDP_Init or DVP_Init.
+ *
+ * @param loopback
+ * @param side TP_LOOPBACK_A or TP_LOOPBACK_B.
+ * @return
+ */
+const void *TP_LoopbackPort(TP_Loopback *loopback, uint8_t side);
+
+/*!
+ * @internal
+ * @private
+ * @brief Sets a function run when a read of an end finds its queue empty, e.g.
+ * to run the peer link, so a blocking call such as LDP_Command1 gets its
+ * response with both ends in one thread. It isn't run again from inside itself.
+ *
+ * @param loopback
+ * @param side  TP_LOOPBACK_A or TP_LOOPBACK_B.
+ * @param idle  Function or NULL.
+ * @param param Parameter of the function.
+ * @return
+ */
+bool TP_LoopbackSetIdle(TP_Loopback *loopback, uint8_t side, void (*idle)(void *param), void *param);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TPLOOPBACK_H_ */
@@ -0,0 +1,188 @@
+/**
+ * @file   Reactor.c
+ * @author Douglas Reis
+ * @date   18/10/2026
+ */
+
+#include "Reactor.h"
+
+#if defined(__linux__)
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+#include "../Core/Helper/Helper.h"
+
+
+static void TPReactorUnready(TP_Reactor *reactor, TP_ReactorLink *link)
+{
+	TP_ReactorLink **node = &reactor->ready;
+
+	while(link->ready && *node != NULL)
+	{
+		if(*node == link)
+		{
+			*node = link->next;
+			link->ready = false;
+		}
+		else
+		{
+			node = &(*node)->next;
+		}
+	}
+}
+
+/*!
+ * @internal
+ * Parses up to TP_REACTOR_BUDGET frames of a link.
+ *
+ * @return Returns true if the budget ran out, frames may still be staged.
+ */
+static bool TPReactorServe(TP_Reactor *reactor, TP_ReactorLink *link)
+{
+	uint32_t frames = 0;
+
+	while(frames < TP_REACTOR_BUDGET && TP_PollFrame(link->obj) != TPIsRunning)
+	{
+		frames++;
+	}
+
+	if(frames == TP_REACTOR_BUDGET)
+	{
+		/* The last poll finished a frame, the next ones may be staged already and epoll won't report them */
+		if(link->ready == false)
+		{
+			link->ready = true;
+			link->next = reactor->ready;
+			reactor->ready = link;
+		}
+
+		return true;
+	}
+
+	if(link->hangup)
+	{
+		/* Starved, bytes left staged can't complete a frame and Read would return 0 forever */
+		TP_ReactorRemove(reactor, link);
+
+		if(reactor->hangup != NULL)
+		{
+			reactor->hangup(reactor->param, link->obj, link->fd);
+		}
+	}
+
+	return false;
+}
+
+bool TP_ReactorInit(TP_Reactor *reactor, ITPReactorHangup hangup, void *param)
+{
+	TP_ASSERT(reactor == NULL);
+
+	reactor->links = 0;
+	reactor->ready = NULL;
+	reactor->hangup = hangup;
+	reactor->param = param;
+	reactor->fd = epoll_create1(0);
+
+	return reactor->fd >= 0;
+
+	end:
+	return false;
+}
+
+bool TP_ReactorAdd(TP_Reactor *reactor, TP_ReactorLink *link, TP_Obj *obj, int fd)
+{
+	TP_ASSERT(reactor == NULL || link == NULL || obj == NULL || obj->handle == NULL || fd < 0);
+
+	/* A link stalled by owned slots would be reported readable on every wait */
+	TP_ASSERT(((TP_Context *)obj->handle)->slots.count > 1);
+
+	link->obj = obj;
+	link->fd = fd;
+	link->next = NULL;
+	link->ready = false;
+	link->hangup = false;
+
+	struct epoll_event event = { .events = EPOLLIN | EPOLLRDHUP, .data.ptr = link };
+	TP_ASSERT(epoll_ctl(reactor->fd, EPOLL_CTL_ADD, fd, &event) != 0);
+
+	reactor->links++;
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_ReactorRemove(TP_Reactor *reactor, TP_ReactorLink *link)
+{
+	TP_ASSERT(reactor == NULL || link == NULL);
+
+	TPReactorUnready(reactor, link);
+	TP_ASSERT(epoll_ctl(reactor->fd, EPOLL_CTL_DEL, link->fd, NULL) != 0);
+
+	reactor->links--;
+	return true;
+
+	end:
+	return false;
+}
+
+int32_t TP_ReactorRun(TP_Reactor *reactor, int32_t timeout)
+{
+	struct epoll_event events[TP_REACTOR_EVENTS];
+	TP_ReactorLink *ready = NULL;
+	bool busy = false;
+	int32_t served = 0;
+	int32_t count = 0;
+
+	TP_ASSERT(reactor == NULL);
+
+	/* Links left with frames staged by the previous run go first */
+	ready = reactor->ready;
+	reactor->ready = NULL;
+	while(ready != NULL)
+	{
+		TP_ReactorLink *link = ready;
+
+		ready = link->next;
+		link->ready = false;
+		busy |= TPReactorServe(reactor, link);
+		served++;
+	}
+
+	/* Waiting only makes sense if no link has frames parsable right away */
+	count = epoll_wait(reactor->fd, events, TP_REACTOR_EVENTS, busy ? 0 : timeout);
+	if(count < 0)
+	{
+		return (errno == EINTR) ? served : -1;
+	}
+
+	for(int32_t i = 0; i < count; i++)
+	{
+		TP_ReactorLink *link = events[i].data.ptr;
+
+		if(events[i].events & (EPOLLHUP | EPOLLERR | EPOLLRDHUP))
+		{
+			link->hangup = true;
+		}
+
+		TPReactorServe(reactor, link);
+	}
+
+	return served + count;
+
+	end:
+	return -1;
+}
+
+void TP_ReactorClose(TP_Reactor *reactor)
+{
+	if(reactor != NULL && reactor->fd >= 0)
+	{
+		close(reactor->fd);
+		reactor->fd = -1;
+	}
+}
+
+#endif /* __linux__ */
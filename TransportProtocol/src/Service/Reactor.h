@@ -0,0 +1,121 @@
+/**
+ * @file   Reactor.h
+ * @author Douglas Reis
+ * @date   18/10/2026
+ * @brief  Serves many links from one thread.
+ * @private
+ * @internal
+ *
+ * Linux only. Each TP_Obj is registered with the file descriptor behind its
+ * driver handle. The links which become readable are parsed with TP_Poll, which
+ * fires their ITPCallback, so no thread is blocked per link.
+ *
+ * epoll reports a link only while its file descriptor has bytes, so a link which
+ * used its whole budget, and may have frames left in its RX staging area, is kept
+ * in a ready list and parsed again by the next run without waiting.
+ */
+
+#ifndef TPREACTOR_H_
+#define TPREACTOR_H_
+
+#include "Service.h"
+
+#if defined(__linux__)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TP_ReactorLink
+{
+	TP_Obj *obj;
+	int fd;
+	struct TP_ReactorLink *next;	/*!< Next link of the ready list */
+	bool ready;						/*!< In the ready list */
+	bool hangup;					/*!< The peer hung up or the fd failed, removed once drained */
+}TP_ReactorLink;
+
+/*!
+ * Receives a link removed after a hang up or an error, e.g. to close its fd.
+ */
+typedef void (*ITPReactorHangup)(void *param, TP_Obj *obj, int fd);
+
+typedef struct
+{
+	int fd;							/*!< epoll instance */
+	uint32_t links;					/*!< Registered links */
+	TP_ReactorLink *ready;			/*!< Links out of budget, parsed again without waiting */
+	ITPReactorHangup hangup;
+	void *param;
+}TP_Reactor;
+
+/*!
+ * @internal
+ * @private
+ * @brief Creates the epoll instance.
+ *
+ * @param reactor
+ * @param hangup Called with each link removed after a hang up or an error, or NULL.
+ * @param param  Parameter of hangup.
+ * @return
+ */
+bool TP_ReactorInit(TP_Reactor *reactor, ITPReactorHangup hangup, void *param);
+
+/*!
+ * @internal
+ * @private
+ * @brief Registers a link. The driver Read must not block, see TP_Poll, and the
+ * link must have a single RX slot, see TP_SetRxSlots.
+ *
+ * @param reactor
+ * @param link Kept by the reactor until the link is removed.
+ * @param obj  Link initialized by TP_Init.
+ * @param fd   File descriptor the driver of the link reads from.
+ * @return
+ */
+bool TP_ReactorAdd(TP_Reactor *reactor, TP_ReactorLink *link, TP_Obj *obj, int fd);
+
+/*!
+ * @internal
+ * @private
+ * @brief Unregisters a link, before its file descriptor is closed. Links which
+ * hung up are removed by TP_ReactorRun.
+ *
+ * @param reactor
+ * @param link
+ * @return
+ */
+bool TP_ReactorRemove(TP_Reactor *reactor, TP_ReactorLink *link);
+
+/*!
+ * @internal
+ * @private
+ * @brief Waits for readable links and parses them. Each link delivers up to
+ * TP_REACTOR_BUDGET frames per call, the rest is left for the next one, which
+ * doesn't wait for it.
+ *
+ * A link whose peer hung up, or whose fd failed, is parsed until no frame can be
+ * finished, then removed and handed to the hangup callback.
+ *
+ * @param reactor
+ * @param timeout Maximum wait in ms, -1 waits forever.
+ * @return Amount of links served or -1 on error.
+ */
+int32_t TP_ReactorRun(TP_Reactor *reactor, int32_t timeout);
+
+/*!
+ * @internal
+ * @private
+ * @brief Closes the epoll instance, the links are not closed.
+ *
+ * @param reactor
+ */
+void TP_ReactorClose(TP_Reactor *reactor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __linux__ */
+
+#endif /* TPREACTOR_H_ */
@@ -5,6 +5,9 @@
  */
 
 #include "Service.h"
+#include "../Core/Helper/Arq.h"
+#include "../Core/Helper/Fragment.h"
+#include "../Core/Helper/Trace.h"
 
 
 bool TP_Init(TP_Obj *obj, TP_Driver *driver, ITPCallback callback, void *param, const void * port, uint32_t timeout, uint8_t *buffer, uint32_t size)
@@ -18,6 +21,7 @@ bool TP_Init(TP_Obj *obj, TP_Driver *driver, ITPCallback callback, void *param,
 	offset += sizeof(TP_Context);
 	TP_ASSERT(offset >= size);
 
+	memset(context, 0, sizeof(TP_Context));
 	memcpy(&context->driver, driver, sizeof(TP_Driver));
 
 	context->port = port;
@@ -26,6 +30,10 @@ bool TP_Init(TP_Obj *obj, TP_Driver *driver, ITPCallback callback, void *param,
 	context->control.maxPayloadSize = (size - offset);
 	context->response.data = buffer + offset;
 
+	context->slots.base = context->response.data;
+	context->slots.size = context->control.maxPayloadSize;
+	context->slots.count = 1;
+
 	offset += context->control.maxPayloadSize;
 	TP_ASSERT(offset > size);
 
@@ -46,42 +54,376 @@ bool TP_Init(TP_Obj *obj, TP_Driver *driver, ITPCallback callback, void *param,
 bool TP_Send(TP_Obj *obj, uint8_t address, const uint8_t *payload, uint32_t size)
 {
 	TP_Context *context = obj->handle;
-	TPResetContext(context);
 
-	context->driver.Flush(context->control.handle);
+	if(context->fragment.fragmentSize > 0)
+	{
+		return TPSendFragmented(context, address, payload, size);
+	}
 
+	if(context->arq.window > 0)
+	{
+		TP_IOVec part = { .buffer = payload, .size = size };
+
+		return TPArqSend(context, address, &part, 1);
+	}
+
+	if(size > UINT16_MAX)
+	{
+		TP_IOVec part = { .buffer = payload, .size = size };
+
+		return TPSendParts(context, address, &part, 1);
+	}
+
+	/* Full duplex, a frame being received and the bytes queued after it are kept */
 	context->command.data = (uint8_t*)payload;
 
 	SET_STX(context->command.stx);
 	TP_Int16ToArray(size, context->command.size);
 	context->command.address = address;
 
-	/*Calcula CRC16*/
-	TPCalculateCRC(&context->command);
+	return TPSend(context, &context->command);
+}
 
-	/* Envia comando */
-	return TPSendFrame(context, &context->command);
+bool TP_Flush(TP_Obj *obj)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
+
+	TP_Context *context = obj->handle;
+	TPResetContext(context);
+	TPFlush(context);
+
+	return true;
+
+	end:
+	return false;
 }
 
-void TP_Process(TP_Obj *obj)
+bool TP_SetRxSlots(TP_Obj *obj, uint8_t count)
 {
+	TP_ASSERT(obj == NULL || obj->handle == NULL || count == 0 || count > TP_RX_SLOTS_MAX);
+
 	TP_Context *context = obj->handle;
+	TPRxSlots *slots = &context->slots;
+	uint32_t area = slots->size * slots->count;
+
+	/* Payloads delivered from the reorder window or the reassembly buffer aren't in a slot */
+	TP_ASSERT(count > 1 && (context->arq.window > 0 || context->fragment.buffer != NULL));
+
 	TPResetContext(context);
-	memset(&context->response, 0, TP_STARTING_FRAME_SIZE);
 
-	context->control.timeout = context->driver.Tick();
-	context->control.bytesRead = 0;
+	slots->size = area / count;
+	slots->count = count;
+	slots->current = 0;
+	slots->owned = 0;
+
+	context->control.maxPayloadSize = slots->size;
+	context->response.data = slots->base;
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_Release(TP_Obj *obj, const uint8_t *payload)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || payload == NULL);
+
+	TP_Context *context = obj->handle;
+	TPRxSlots *slots = &context->slots;
+
+	if(slots->count > 1)
+	{
+		TP_ASSERT(payload < slots->base || payload >= &slots->base[slots->size * slots->count]);
+
+		uint32_t index = (payload - slots->base) / slots->size;
+		TP_ATOMIC_AND(&slots->owned, ~(1UL << index));
+	}
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_SetArq(TP_Obj *obj, uint8_t *buffer, uint32_t size, uint8_t window, uint32_t timeout, uint8_t trials)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || window > TP_ARQ_WINDOW_MAX || trials == 0 || trials == UINT8_MAX);
+	TP_ASSERT(window > 0 && (buffer == NULL || size / (2 * window) <= TP_ARQ_SLOT_HEADER_SIZE + TP_ARQ_HEADER_SIZE));
+
+	TP_Context *context = obj->handle;
+	TP_ASSERT(window > 0 && context->slots.count > 1);
+
+	memset(&context->arq, 0, sizeof(TPArq));
+
+	context->arq.buffer = buffer;
+	context->arq.slotSize = (window > 0) ? size / (2 * window) : 0;
+	context->arq.retransmitTimeout = timeout;
+	context->arq.trials = trials;
+	context->arq.window = window;
+	context->arq.status = TPSuccess;
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_SetFragmentation(TP_Obj *obj, uint16_t fragmentSize, uint8_t *buffer, uint32_t size)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || (buffer == NULL && size != 0));
+	TP_ASSERT(fragmentSize != 0 && fragmentSize <= TP_FRAGMENT_HEADER_SIZE);
+
+	TP_Context *context = obj->handle;
+	TP_ASSERT(buffer != NULL && context->slots.count > 1);
+
+	memset(&context->fragment, 0, sizeof(TPFragment));
+
+	context->fragment.buffer = buffer;
+	context->fragment.size = size;
+	context->fragment.fragmentSize = fragmentSize;
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_SetTxBuffer(TP_Obj *obj, uint8_t *buffer, uint32_t size)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || (buffer == NULL && size != 0));
+
+	TP_Context *context = obj->handle;
+	context->tx.buffer = buffer;
+	context->tx.size = size;
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_GetCounters(TP_Obj *obj, TPCounters *counters)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || counters == NULL);
+
+	TP_Context *context = obj->handle;
+	memcpy(counters, &context->counters, sizeof(TPCounters));
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_ResetCounters(TP_Obj *obj)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
+
+	TP_Context *context = obj->handle;
+	memset(&context->counters, 0, sizeof(TPCounters));
+
+	if(context->histograms != NULL)
+	{
+		memset(context->histograms, 0, sizeof(TPHistograms));
+	}
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_SetHistograms(TP_Obj *obj, TPHistograms *histograms)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
+
+	TP_Context *context = obj->handle;
+
+	if(histograms != NULL)
+	{
+		memset(histograms, 0, sizeof(TPHistograms));
+	}
+	context->histograms = histograms;
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_SetTrace(TP_Obj *obj, TPTraceRecord *records, uint32_t count)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || (records != NULL && (count == 0 || (count & (count - 1)) != 0)));
+
+	TP_Context *context = obj->handle;
+	context->trace.records = NULL;
+	context->trace.mask = (records != NULL) ? count - 1 : 0;
+	context->trace.head = 0;
+	context->trace.records = records;
+
+	return true;
+
+	end:
+	return false;
+}
+
+uint32_t TP_GetTrace(TP_Obj *obj, TPTraceRecord *records, uint32_t count)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || records == NULL);
+
+	TP_Context *context = obj->handle;
+	TP_ASSERT(context->trace.records == NULL);
+
+	return TPTraceRead(context, records, count);
+
+	end:
+	return 0;
+}
+
+bool TP_SetCapture(TP_Obj *obj, ITPCapture capture, void *param)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
 
-	context->state = TPIdleState;
+	TP_Context *context = obj->handle;
+	context->capture.callback = NULL;
+	context->capture.param = param;
+	context->capture.callback = capture;
+
+	return true;
+
+	end:
+	return false;
+}
+
+bool TP_SetOptions(TP_Obj *obj, uint32_t options)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
+
+	TP_Context *context = obj->handle;
+	context->options = options;
+
+	return true;
+
+	end:
+	return false;
+}
+
+/*!
+ * @internal
+ * Runs the state machine until a frame is finished or, in non blocking mode,
+ * until the bytes run out. A frame left partial by a previous run is resumed.
+ */
+static void TPRun(TP_Context *context, bool nonBlocking)
+{
+	if(context->arq.window > 0)
+	{
+		TPArqCheckTimers(context);
+	}
+
+	if(context->state == NULL && TPAcquireSlot(context) == false)
+	{
+		/* Every slot is still owned by the application, the bytes wait in the driver */
+		context->control.status = TPIsRunning;
+		return;
+	}
+
+	if(context->state == NULL)
+	{
+		TPResetContext(context);
+		memset(&context->response, 0, TP_STARTING_FRAME_SIZE);
+
+		context->state = (context->driver.capabilities & TP_DRIVER_DATAGRAM) ? TPDatagramState : TPIdleState;
+	}
+
+	context->control.nonBlocking = nonBlocking;
+	context->control.status = TPNone;
+	if(nonBlocking == false)
+	{
+		context->control.timeout = context->driver.Tick();
+	}
 
 	do
 	{
+		ITPState state = context->state;
+
 		(*context->state)(context);
-	} while(context->state != NULL);
+		TPTraceState(context, state);
+	} while(context->state != NULL && context->control.status != TPIsRunning);
+
+	if(context->state == NULL)
+	{
+		TPCountFrame(context);
+	}
+}
+
+TPStatus TP_Poll(TP_Obj *obj)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
+
+	TP_Context *context = obj->handle;
+
+	do
+	{
+		TPRun(context, true);
+	} while((context->options & TP_OPTION_STREAMING) && context->control.status != TPIsRunning);
+
+	return context->control.status;
+
+	end:
+	return TPFailure;
+}
+
+TPStatus TP_PollFrame(TP_Obj *obj)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL);
+
+	TP_Context *context = obj->handle;
+	TPRun(context, true);
+
+	return context->control.status;
+
+	end:
+	return TPFailure;
+}
+
+uint32_t TP_Feed(TP_Obj *obj, const uint8_t *bytes, uint32_t length)
+{
+	TP_ASSERT(obj == NULL || obj->handle == NULL || bytes == NULL);
+
+	TP_Context *context = obj->handle;
+	context->rx.feed = bytes;
+	context->rx.feedLength = length;
+
+	/* Every frame in the bytes is delivered, the parser starves once they run out */
+	do
+	{
+		TPRun(context, true);
+	} while(context->control.status != TPIsRunning);
+
+	length -= context->rx.feedLength;
+	context->rx.feed = NULL;
+	context->rx.feedLength = 0;
+
+	return length;
+
+	end:
+	return 0;
+}
+
+void TP_Process(TP_Obj *obj)
+{
+	TP_Context *context = obj->handle;
+
+	TPRun(context, false);
 
-	if(context->control.status == TPSuccess && context->callback)
+	/* Drains the frames already available, trailing bytes of a partial frame wait for the next call */
+	if(context->options & TP_OPTION_STREAMING)
 	{
-		context->callback(context->param, context->response.address, TPGetSize(context->response.size), context->response.data);
+		while(context->control.status != TPTimeout && context->control.status != TPIsRunning)
+		{
+			TPRun(context, true);
+		}
 	}
 }
 
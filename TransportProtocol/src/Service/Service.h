@@ -55,14 +55,265 @@ bool TP_Init(TP_Obj *obj, TP_Driver *driver, ITPCallback callback, void *param,c
  */
 bool TP_Send(TP_Obj *obj, uint8_t address, const uint8_t *payload, uint32_t size);
 
+/*!
+ * @internal
+ * @private
+ * @brief Enables the reliable mode, both ends must enable it with the same window.
+ *
+ * Selective repeat ARQ: up to window frames are sent without waiting for their
+ * acknowledgement, frames received out of order are kept until the gap is filled
+ * and delivered in order. A lost frame is sent again when a NAK asks for it or
+ * after the retransmission timeout. Once a frame was sent trials times and the
+ * last one timed out, NAKs not counted, TP_Send fails with TPTimeout; the timer keeps
+ * sending it and TP_Send works again as soon as the peer acknowledges it.
+ *
+ * TP_Send fails with the status TPIsRunning in TPTxControl while the window is
+ * full, TP_Poll or TP_Process must run to receive the acknowledgements and to
+ * send the frames again.
+ *
+ * Frames received out of order are delivered from the reorder window, which is
+ * reused by the next ones, so the payload is only valid during the callback and
+ * the reliable mode fails with more than one RX slot, see TP_SetRxSlots.
+ *
+ * @param obj
+ * @param buffer  Window of sent frames and reorder window, split in 2 * window slots
+ *                of payload plus 10 bytes each.
+ * @param size    Buffer size.
+ * @param window  Frames in flight, up to TP_ARQ_WINDOW_MAX, or 0 to disable it.
+ * @param timeout Retransmission timeout, in TP_Driver::Tick units.
+ * @param trials  Transmissions of a frame before the link is reported down, e.g. TP_TRIALS_AMOUNT,
+ *                up to UINT8_MAX - 1.
+ * @return
+ */
+bool TP_SetArq(TP_Obj *obj, uint8_t *buffer, uint32_t size, uint8_t window, uint32_t timeout, uint8_t trials);
+
+/*!
+ * @internal
+ * @private
+ * @brief Enables fragmentation, both ends must enable it.
+ *
+ * TP_Send splits payloads in frames of up to fragmentSize bytes, 5 of them taken
+ * by the fragment header, so payloads may exceed the RX buffer of the peer and
+ * the 64 KiB of a frame. The receiving side reassembles them in buffer and the
+ * callback gets the whole payload. A payload with a lost fragment is dropped
+ * with TPFrameError, one beyond the buffer with TPBufferOverflow.
+ *
+ * With TP_SetArq the fragments of a payload must fit the free part of the send
+ * window, otherwise TP_Send fails with the status TPIsRunning in TPTxControl.
+ *
+ * The reassembled payload is only valid during the callback, the first fragment
+ * of the next one overwrites it, so a reassembly buffer fails with more than one
+ * RX slot, see TP_SetRxSlots.
+ *
+ * @param obj
+ * @param fragmentSize Largest frame payload sent, 0 to send without fragments.
+ * @param buffer       Reassembly buffer or NULL to receive without fragments.
+ * @param size         Reassembly buffer size, the largest payload received.
+ * @return
+ */
+bool TP_SetFragmentation(TP_Obj *obj, uint16_t fragmentSize, uint8_t *buffer, uint32_t size);
+
+/*!
+ * @internal
+ * @private
+ * @brief Discards the frame being received and every byte already received.
+ * TP_Send doesn't do it, so frames can be sent while one is being received.
+ *
+ * @param obj
+ * @return
+ */
+bool TP_Flush(TP_Obj *obj);
+
+/*!
+ * @internal
+ * @private
+ * @brief Splits the payload area given to TP_Init in slots, reducing the maximum
+ * payload to a slot. The payload passed to the callback stays owned by the
+ * application until TP_Release, while the next frames are received in the other
+ * slots. When every slot is owned no frame is parsed and TP_Poll returns
+ * TPIsRunning. Called before any traffic; one slot, the default, needs no release.
+ * More than one slot fails with the reliable mode or reassembly enabled, see
+ * TP_SetArq and TP_SetFragmentation.
+ *
+ * @param obj
+ * @param count Amount of slots, up to TP_RX_SLOTS_MAX.
+ * @return
+ */
+bool TP_SetRxSlots(TP_Obj *obj, uint8_t count);
+
+/*!
+ * @internal
+ * @private
+ * @brief Gives a slot back to the parser, may be called from another thread.
+ *
+ * @param obj
+ * @param payload Payload passed to the callback.
+ * @return
+ */
+bool TP_Release(TP_Obj *obj, const uint8_t *payload);
+
+/*!
+ * @internal
+ * @private
+ * @brief Sets a staging area where TP_Send builds the whole frame, so it is
+ * hashed while copied and written to the driver at once. Frames which don't fit
+ * are sent in three writes as before.
+ *
+ * @param obj
+ * @param buffer Staging area or NULL to disable it.
+ * @param size   Staging area size, payload plus 7 to 10 bytes of header and CRC.
+ * @return
+ */
+bool TP_SetTxBuffer(TP_Obj *obj, uint8_t *buffer, uint32_t size);
+
+/*!
+ * @internal
+ * @private
+ * @brief Copies the link counters, always kept.
+ *
+ * @param obj
+ * @param counters Receives the counters.
+ * @return
+ */
+bool TP_GetCounters(TP_Obj *obj, TPCounters *counters);
+
+/*!
+ * @internal
+ * @private
+ * @brief Starts filling tick histograms of the frames received and of the
+ * callbacks, each costing TP_Driver::Tick calls. They are read in place.
+ *
+ * The receive time histogram tells a link waiting for bytes, with frames which
+ * take many ticks, from one spending its time in the callbacks.
+ *
+ * @param obj
+ * @param histograms Histograms, zeroed here, or NULL to stop filling them.
+ * @return
+ */
+bool TP_SetHistograms(TP_Obj *obj, TPHistograms *histograms);
+
+/*!
+ * @internal
+ * @private
+ * @brief Zeroes the link counters and histograms, e.g. after each snapshot for rates.
+ *
+ * @param obj
+ * @return
+ */
+bool TP_ResetCounters(TP_Obj *obj);
+
+/*!
+ * @internal
+ * @private
+ * @brief Starts tracing the parser states into a ring of records, overwriting
+ * the oldest ones once it is full. Each record costs a TP_Driver::Tick call.
+ *
+ * @param obj
+ * @param records Ring or NULL to stop tracing.
+ * @param count   Amount of records, a power of 2.
+ * @return
+ */
+bool TP_SetTrace(TP_Obj *obj, TPTraceRecord *records, uint32_t count);
+
+/*!
+ * @internal
+ * @private
+ * @brief Copies the newest trace records, oldest first, e.g. to be written to
+ * a file decoded by tools/TraceDump.py. It may run while the link is in use.
+ *
+ * @param obj
+ * @param records Destination.
+ * @param count   Maximum amount of records.
+ * @return Amount of records copied.
+ */
+uint32_t TP_GetTrace(TP_Obj *obj, TPTraceRecord *records, uint32_t count);
+
+/*!
+ * @internal
+ * @private
+ * @brief Hands every frame received with its CRC verdict and every frame sent to
+ * a capture callback, e.g. the pcapng writer of tools/Pcapng.c. Frames dropped
+ * before their CRC, a corrupted header or a timeout, are only counted.
+ *
+ * @param obj
+ * @param capture Callback or NULL to stop capturing.
+ * @param param   Parameter of the callback.
+ * @return
+ */
+bool TP_SetCapture(TP_Obj *obj, ITPCapture capture, void *param);
+
+/*!
+ * @internal
+ * @private
+ * @brief Sets the TP_OPTION_* flags.
+ *
+ * TP_OPTION_JUMBO and TP_OPTION_HEADER_CHECK must be set on both ends, the
+ * buffer given to TP_Init bounds the jumbo frames received.
+ *
+ * @param obj
+ * @param options
+ * @return
+ */
+bool TP_SetOptions(TP_Obj *obj, uint32_t options);
+
 /*!
  * @internal
  * @private  
+ * @brief Waits for a frame and delivers it to the callback. With
+ * TP_OPTION_STREAMING the frames which follow it and are already available
+ * are delivered too; a partial frame is kept and finished by the next call.
  *
  * @param obj
  */
 void TP_Process(TP_Obj *obj);
 
+/*!
+ * @internal
+ * @private
+ * @brief Non blocking TP_Process. Parses only the bytes the driver already has
+ * and returns as soon as they run out, keeping a partial frame for the next call.
+ * A frame is discarded with TPTimeout when it isn't finished within the timeout
+ * counted from its STX.
+ *
+ * @param obj
+ * @return Status of the frame finished by this call or TPIsRunning when the
+ * bytes ran out first, so it is called again until TPIsRunning to drain the
+ * link. With TP_OPTION_STREAMING every available frame is delivered and the
+ * return is always TPIsRunning.
+ */
+TPStatus TP_Poll(TP_Obj *obj);
+
+/*!
+ * @internal
+ * @private
+ * @brief TP_Poll finishing at most one frame, even with TP_OPTION_STREAMING, so
+ * a caller serving many links can bound the frames of each one.
+ *
+ * @param obj
+ * @return Status of the frame finished by this call or TPIsRunning when the
+ * bytes ran out first.
+ */
+TPStatus TP_PollFrame(TP_Obj *obj);
+
+/*!
+ * @internal
+ * @private
+ * @brief Push mode TP_Poll, parses bytes the caller already has, e.g. from a DMA
+ * interrupt or a batch of datagrams, instead of reading them from the driver.
+ *
+ * Every frame in the bytes is delivered, a partial one is kept and finished by
+ * the bytes of the next call. Payloads are copied straight from the bytes to the
+ * RX buffer; TP_Driver::Tick is still used for the timeout of a partial frame.
+ *
+ * @param obj
+ * @param bytes  Bytes received.
+ * @param length Amount of bytes.
+ * @return Amount of bytes taken, parsed or kept in the RX staging area. It is
+ * less than length only when every RX slot is owned by the application, the
+ * rest must be given again after TP_Release.
+ */
+uint32_t TP_Feed(TP_Obj *obj, const uint8_t *bytes, uint32_t length);
+
 #ifdef __cplusplus
 }
 #endif
@@ -6,33 +6,71 @@
  */
 
 #include "../../Core/Helper/Helper.h"
+#include "../../Core/Helper/Arq.h"
 #include "../../Core/States/State.h"
 
 
 void TPChecksumState(TP_Context *context)
 {
-	uint16_t size = TPGetSize(context->response.size);
-	uint32_t index = context->control.bytesRead - TP_STARTING_FRAME_SIZE - size;
+	uint32_t size = context->control.payloadSize;
+	uint32_t index = context->control.bytesRead - context->control.headerSize - size;
 
-	context->control.bytesRead += context->driver.Read(context->control.handle,
-			&context->response.crc[index], TP_CRC_SIZE - index);
+	context->control.bytesRead += TPRead(context, &context->response.crc[index], TP_CRC_SIZE - index);
 
-	index = context->control.bytesRead - TP_STARTING_FRAME_SIZE - size;
+	index = context->control.bytesRead - context->control.headerSize - size;
 	if(index == TP_CRC_SIZE)
 	{
-		context->control.status = TPErrorChecksum;
-		if(TPIsValidCRC(&context->response) == true)
-		{
-			context->control.status = TPSuccess;
-		}
-		context->state = NULL;
+		TPFrameReceived(context, context->response.data);
+	}
+	else if (TPRxPending(context) == 0)
+	{
+		TPCheckStarvation(context);
+	}
+
+}
+
+void TPFrameReceived(TP_Context *context, uint8_t *payload)
+{
+	uint32_t size = context->control.payloadSize;
+
+	context->control.status = TPErrorChecksum;
+	context->state = NULL;
+
+	if(TPIsExpectedCRC(context->control.crc, context->response.crc) == true)
+	{
+		context->control.status = TPSuccess;
 	}
-	else if (TPIsTimeout(context) == true)
+
+	if(context->capture.callback != NULL)
 	{
-		TPResetContext(context);
+		TP_IOVec frame[] =
+		{
+				{ .buffer = context->control.header, .size = context->control.headerSize },
+				{ .buffer = payload,                 .size = size },
+				{ .buffer = context->response.crc,   .size = TP_CRC_SIZE }
+		};
 
-		context->control.status = TPTimeout;
-		context->state = NULL;
+		TPCaptureFrame(context, TP_CAPTURE_RX, context->control.status, frame, sizeof(frame) / sizeof(frame[0]));
 	}
 
+	if(context->arq.window == 0)
+	{
+		if(context->control.status == TPSuccess)
+		{
+			TPDeliver(context, context->response.address, payload, size);
+		}
+	}
+	else if(context->control.status == TPSuccess && size < TP_ARQ_HEADER_SIZE)
+	{
+		context->control.status = TPFrameError;
+	}
+	else if(context->control.status == TPSuccess && context->response.data[0] != TP_ARQ_DATA)
+	{
+		context->state = TPNAKResponseState;
+	}
+	else
+	{
+		/* Acknowledges a DATA frame or asks again for a corrupted one */
+		context->state = TPNAKRequestState;
+	}
 }
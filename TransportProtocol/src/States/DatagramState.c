@@ -0,0 +1,63 @@
+/**
+ * @file    DatagramState.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Receiving side of drivers with TP_DRIVER_DATAGRAM: each read is a whole frame,
+ * validated in one step instead of going through the byte stream states.
+ */
+
+#include "../../Core/Helper/Helper.h"
+#include "../../Core/States/State.h"
+#include "../../Core/Hash/CRC/CRC16.h"
+
+
+void TPDatagramState(TP_Context *context)
+{
+	TPControl *control = &context->control;
+	uint8_t *buffer = context->response.data;
+	uint32_t length = TPReadSource(context, buffer, context->slots.size);
+
+	if(length == 0)
+	{
+		TPCheckStarvation(context);
+		return;
+	}
+
+	context->state = NULL;
+	control->started = context->driver.Tick();
+	control->bytesRead = length;
+	control->headerSize = (length >= TP_STX_SIZE) ? TPHeaderSize(context, buffer) : 0;
+
+	if(control->headerSize == 0 || length < control->headerSize + TP_CRC_SIZE ||
+	   TPDecodeHeader(context, buffer) == false || control->headerSize + control->payloadSize + TP_CRC_SIZE != length)
+	{
+		/* Not a frame, there is nothing to resync with inside a datagram */
+		context->counters.skippedBytes += length;
+		context->counters.resyncs++;
+
+		control->status = TPFrameError;
+		return;
+	}
+
+	control->crc = TP_CRC16(buffer, control->headerSize + control->payloadSize);
+	memcpy(control->header, buffer, control->headerSize);
+	memcpy(context->response.crc, &buffer[length - TP_CRC_SIZE], TP_CRC_SIZE);
+
+	if(context->arq.window > 0)
+	{
+		/* The reliable mode states expect the payload at the start of the slot */
+		memmove(buffer, &buffer[control->headerSize], control->payloadSize);
+		TPFrameReceived(context, buffer);
+	}
+	else
+	{
+		TPFrameReceived(context, &buffer[control->headerSize]);
+	}
+}
@@ -14,41 +14,57 @@
  
 #include "../../Core/States/State.h"
 #include "../../Core/Helper/Helper.h"
+#include "../../Core/Helper/Scan.h"
 
 void TPIdleState(TP_Context *context)
 {
-	uint8_t *buffer = (uint8_t *)&context->response;
+	TPControl *control = &context->control;
+	TPRxBuffer *rx = &context->rx;
 
-	context->control.bytesRead += context->driver.Read(context->control.handle,
-				(void *)&buffer[context->control.bytesRead], TP_STX_SIZE - context->control.bytesRead);
+	if(TPRxPending(context) < TP_STX_SIZE)
+	{
+		TPFill(context);
+	}
 
-	if(context->control.bytesRead >= TP_STX_SIZE)
+	/* Junk is skipped a whole chunk at a time */
+	uint16_t pending = TPRxPending(context);
+	uint16_t offset = TPScanSTX(&rx->data[rx->head], pending);
+	if(offset > 0)
 	{
-		if(memcmp(buffer, TP_STX, TP_STX_SIZE) == 0)
-		{
-			context->state = TPStartingFrameState;
-		}
-		else
-		{
-			if(buffer[1] == TP_STX[0])
-			{
-				buffer[0] = buffer[1];
-				context->control.bytesRead = 1;
-			}
-			else
-			{
-				context->control.bytesRead = 0;
-			}
-		}
+		context->counters.skippedBytes += offset;
+		context->counters.resyncs++;
+
+		rx->head += offset;
+		pending -= offset;
 	}
 
-	if (context->state == TPIdleState && TPIsTimeout(context) == true)
+	uint8_t headerSize = (pending >= TP_STX_SIZE) ? TPHeaderSize(context, &rx->data[rx->head]) : 0;
+	if(pending >= TP_STX_SIZE && headerSize == 0)
 	{
-		TPLog(TPTimeout, "Timeout");
+		/* Jumbo frames were not agreed, the STX is junk */
+		context->counters.skippedBytes++;
+		context->counters.resyncs++;
 
-		TPResetContext(context);
+		rx->head++;
+	}
+	else if(headerSize > 0)
+	{
+		memcpy(control->header, &rx->data[rx->head], TP_STX_SIZE);
+		rx->head += TP_STX_SIZE;
+		control->bytesRead = TP_STX_SIZE;
+		control->headerSize = headerSize;
 
-		context->control.status = TPTimeout;
-		context->state = NULL;
+		/* In non blocking mode the timeout runs from the STX, the wait for it is free */
+		control->started = context->driver.Tick();
+		if(control->nonBlocking == true)
+		{
+			control->timeout = control->started;
+		}
+
+		context->state = TPStartingFrameState;
+	}
+	else
+	{
+		TPCheckStarvation(context);
 	}
 }
@@ -0,0 +1,80 @@
+/**
+ * @file    NAKRequestState.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Receiving side of the reliable mode: acknowledges DATA frames, keeps the ones
+ * received out of order and asks for the missing ones.
+ */
+
+#include "../../Core/Helper/Helper.h"
+#include "../../Core/Helper/Arq.h"
+#include "../../Core/States/State.h"
+
+
+void TPNAKRequestState(TP_Context *context)
+{
+	TPArq *arq = &context->arq;
+	uint8_t address = context->response.address;
+	uint8_t *data = context->response.data;
+	uint32_t size = context->control.payloadSize - TP_ARQ_HEADER_SIZE;
+	uint8_t offset = data[1] - arq->expected;
+
+	context->state = NULL;
+
+	if(context->control.status != TPSuccess)
+	{
+		/* The corrupted frame is most likely the one expected */
+		TPArqSendNak(context, address, arq->expected);
+	}
+	else if(offset == 0)
+	{
+		uint8_t first = arq->expected;
+		uint8_t firstIndex = arq->expectedIndex;
+
+		do
+		{
+			arq->received &= ~TPArqRxBit(context, arq->expected);
+			arq->expected++;
+			arq->expectedIndex = (arq->expectedIndex + 1) % arq->window;
+		} while(arq->received & TPArqRxBit(context, arq->expected));
+
+		/* Acknowledged before the callbacks, which may take long */
+		TPArqSendAck(context, address);
+
+		TPDeliver(context, address, &data[TP_ARQ_HEADER_SIZE], size);
+		for(uint8_t sequence = first + 1; sequence != arq->expected; sequence++)
+		{
+			uint8_t *slot = TPArqSlot(context, arq->window + (firstIndex + (uint8_t)(sequence - first)) % arq->window);
+			TPDeliver(context, slot[2], &slot[TP_ARQ_SLOT_HEADER_SIZE + TP_ARQ_HEADER_SIZE], TP_ArrayToInt16(slot));
+		}
+	}
+	else if(offset < arq->window)
+	{
+		uint8_t *slot = TPArqSlot(context, arq->window + TPArqRxIndex(context, data[1]));
+
+		if((arq->received & TPArqRxBit(context, data[1])) == 0 && size <= UINT16_MAX &&
+		   TP_ARQ_SLOT_HEADER_SIZE + TP_ARQ_HEADER_SIZE + size <= arq->slotSize)
+		{
+			TP_Int16ToArray(size, slot);
+			slot[2] = address;
+			memcpy(&slot[TP_ARQ_SLOT_HEADER_SIZE], data, TP_ARQ_HEADER_SIZE + size);
+
+			arq->received |= TPArqRxBit(context, data[1]);
+		}
+
+		TPArqSendNak(context, address, arq->expected);
+		TPArqSendAck(context, address);
+	}
+	else
+	{
+		/* Duplicate of a frame already delivered, its acknowledgement was lost */
+		TPArqSendAck(context, address);
+	}
+}
@@ -0,0 +1,67 @@
+/**
+ * @file    NAKResponseState.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Sending side of the reliable mode: slides the send window on ACK and sends a
+ * frame again as soon as a NAK asks for it.
+ */
+
+#include "../../Core/Helper/Helper.h"
+#include "../../Core/Helper/Arq.h"
+#include "../../Core/States/State.h"
+
+
+void TPNAKResponseState(TP_Context *context)
+{
+	TPArq *arq = &context->arq;
+	uint8_t *data = context->response.data;
+	uint32_t size = context->control.payloadSize;
+	uint8_t inFlight = arq->next - arq->base;
+
+	context->state = NULL;
+
+	if(data[0] == TP_ARQ_NAK)
+	{
+		/* Fast retransmit, without waiting for the timeout */
+		if(TPArqIsInWindow(data[1], arq->base, inFlight) && (arq->acked & TPArqTxBit(context, data[1])) == 0)
+		{
+			TPArqTransmit(context, data[1]);
+		}
+	}
+	else if(data[0] == TP_ARQ_ACK && size >= TP_ARQ_ACK_SIZE)
+	{
+		uint32_t selective = TP_ArrayToInt32((&data[2]));
+
+		/* Cumulative, every frame before the one expected was received */
+		if((uint8_t)(data[1] - arq->base) <= inFlight)
+		{
+			while(arq->base != data[1])
+			{
+				arq->acked &= ~TPArqTxBit(context, arq->base);
+				arq->base++;
+				arq->baseIndex = (arq->baseIndex + 1) % arq->window;
+			}
+		}
+
+		for(uint8_t i = 0; selective != 0; i++, selective >>= 1)
+		{
+			uint8_t sequence = data[1] + 1 + i;
+
+			if((selective & 1) && TPArqIsInWindow(sequence, arq->base, (uint8_t)(arq->next - arq->base)))
+			{
+				arq->acked |= TPArqTxBit(context, sequence);
+			}
+		}
+	}
+	else
+	{
+		context->control.status = TPFrameError;
+	}
+}
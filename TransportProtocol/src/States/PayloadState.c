@@ -14,27 +14,26 @@
 
 #include "../../Core/Helper/Helper.h"
 #include "../../Core/States/State.h"
+#include "../../Core/Hash/CRC/CRC16.h"
 
 
 void TPPayloadState(TP_Context *context)
 {
-	uint16_t size = TPGetSize(context->response.size);
-	uint32_t index = context->control.bytesRead - TP_STARTING_FRAME_SIZE;
+	uint32_t size = context->control.payloadSize;
+	uint32_t index = context->control.bytesRead - context->control.headerSize;
 
-	context->control.bytesRead += context->driver.Read(context->control.handle,
-			&context->response.data[index], size - index);
+	uint32_t read = TPRead(context, &context->response.data[index], size - index);
 
-	if(context->control.bytesRead == (TP_STARTING_FRAME_SIZE + size))
+	/* Hash the chunk while it is still in cache instead of walking the whole frame at the end */
+	context->control.crc = TP_CRC16Add(&context->response.data[index], read, context->control.crc);
+	context->control.bytesRead += read;
+
+	if(context->control.bytesRead == (context->control.headerSize + size))
 	{
 		context->state = TPChecksumState;
 	}
-	else if (TPIsTimeout(context) == true)
+	else if (TPRxPending(context) == 0)
 	{
-		TPLog(TPTimeout, "Timeout");
-
-		TPResetContext(context);
-
-		context->control.status = TPTimeout;
-		context->state = NULL;
+		TPCheckStarvation(context);
 	}
 }
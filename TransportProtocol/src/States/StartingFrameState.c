@@ -14,19 +14,32 @@
 
 #include "../../Core/Helper/Helper.h"
 #include "../../Core/States/State.h"
+#include "../../Core/Hash/CRC/CRC16.h"
 
 
 void TPStartingFrameState(TP_Context *context)
 {
-	uint8_t *buffer = (uint8_t *)&context->response;
+	TPControl *control = &context->control;
 
-	context->control.bytesRead += context->driver.Read(context->control.handle,
-			(void *)&buffer[context->control.bytesRead], TP_STARTING_FRAME_SIZE - context->control.bytesRead);
+	control->bytesRead += TPRead(context, &control->header[control->bytesRead],
+			control->headerSize - control->bytesRead);
 
-	if(context->control.bytesRead >= TP_STARTING_FRAME_SIZE)
+	if(control->bytesRead >= control->headerSize && TPDecodeHeader(context, control->header) == false)
 	{
-		if(TPGetSize(context->response.size) <= context->control.maxPayloadSize)
+		/* Resyncs right after the STX, as far as the staging area still has the header, instead of
+		 * waiting for a payload of a size which may be corrupted */
+		uint8_t rewind = control->headerSize - 1;
+		context->rx.head -= (context->rx.head < rewind) ? context->rx.head : rewind;
+
+		context->counters.badHeaders++;
+		control->bytesRead = 0;
+		context->state = TPIdleState;
+	}
+	else if(control->bytesRead >= control->headerSize)
+	{
+		if(control->payloadSize <= control->maxPayloadSize)
 		{
+			control->crc = TP_CRC16(control->header, control->headerSize);
 			context->state = TPPayloadState;
 		}
 		else
@@ -38,14 +51,9 @@ void TPStartingFrameState(TP_Context *context)
 		}
 	}
 
-	else if (TPIsTimeout(context) == true)
+	else if (TPRxPending(context) == 0)
 	{
-		TPLog(TPTimeout, "Timeout");
-
-		TPResetContext(context);
-
-		context->control.status = TPTimeout;
-		context->state = NULL;
+		TPCheckStarvation(context);
 	}
 
 }
@@ -17,6 +17,8 @@
 
 #include <Core/Core.h>
 #include "Service/Service.h"
+#include "Service/Reactor.h"
+#include "Service/Loopback.h"
 #include "Core/Helper/Helper.h"
 
 #endif
@@ -0,0 +1,228 @@
+/*!
+ * @file ArqTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Two links of the reliable mode connected by memory pipes which drop and
+ *  corrupt frames. Every message must arrive once and in order, whatever the
+ *  window, and a link reported down must come back with its peer.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+#define MESSAGES		300
+#define RETRANSMIT		20
+
+/* Message i starts with i and has 4 + i % 60 bytes */
+static bool Check(Link *link, uint32_t size, const uint8_t *payload)
+{
+	uint32_t index = TP_ArrayToInt32(payload);
+
+	return index == link->received && size == 4 + (index % 60);
+}
+
+static bool ArqInit(Link *link, Port *port, uint8_t window, uint8_t trials)
+{
+	return LinkInit(link, port, Check) &&
+			TP_SetTxBuffer(&link->obj, link->txBuffer, sizeof(link->txBuffer)) &&
+			TP_SetOptions(&link->obj, TP_OPTION_STREAMING) &&
+			TP_SetArq(&link->obj, link->window, 2 * window * LINK_ARQ_SLOT_SIZE, window, RETRANSMIT, trials);
+}
+
+static bool TestLossyLink(uint8_t window)
+{
+	static PipePair pipes;
+	static Link a, b;
+	uint8_t payload[64];
+	uint32_t sent = 0;
+
+	PipePairInit(&pipes);
+	pipes.forward.dropEvery = 7;
+	pipes.forward.corruptEvery = 11;
+	pipes.backward.dropEvery = 5;
+
+	if(ArqInit(&a, &pipes.a, window, TP_TRIALS_AMOUNT) == false || ArqInit(&b, &pipes.b, window, TP_TRIALS_AMOUNT) == false)
+	{
+		printf("ARQ lossy   : init failed\n");
+		return false;
+	}
+
+	for(uint32_t round = 0; round < 100000 && b.received < MESSAGES; round++)
+	{
+		while(sent < MESSAGES)
+		{
+			TP_Int32ToArray(sent, payload);
+			if(TP_Send(&a.obj, 1, payload, 4 + (sent % 60)) == false)
+			{
+				break;
+			}
+			sent++;
+		}
+
+		TP_Poll(&b.obj);
+		TP_Poll(&a.obj);
+		pipeNow++;
+	}
+
+	if(b.received != MESSAGES || b.errors != 0 || ((TP_Context *)a.obj.handle)->arq.status != TPSuccess)
+	{
+		printf("ARQ lossy   : window %u received %u of %u, errors %u\n", window, b.received, MESSAGES, b.errors);
+		return false;
+	}
+
+	return true;
+}
+
+static bool TestGiveUp(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+	uint8_t payload[8] = { 0 };
+
+	PipePairInit(&pipes);
+	pipes.forward.dropEvery = 1;
+
+	if(ArqInit(&a, &pipes.a, 4, TP_TRIALS_AMOUNT) == false || ArqInit(&b, &pipes.b, 4, TP_TRIALS_AMOUNT) == false ||
+	   TP_Send(&a.obj, 1, payload, sizeof(payload)) == false)
+	{
+		printf("ARQ give up : send failed\n");
+		return false;
+	}
+
+	/* NAKs don't count, the peer is unreachable */
+	for(uint32_t round = 0; round < RETRANSMIT * (TP_TRIALS_AMOUNT + 2); round++)
+	{
+		TP_Poll(&b.obj);
+		TP_Poll(&a.obj);
+		pipeNow++;
+	}
+
+	TP_Context *context = a.obj.handle;
+	if(pipes.forward.writes < TP_TRIALS_AMOUNT || TP_Send(&a.obj, 1, payload, sizeof(payload)) == true ||
+	   context->tx.status != TPTimeout)
+	{
+		printf("ARQ give up : %u transmissions, status %d\n", pipes.forward.writes, context->tx.status);
+		return false;
+	}
+
+	/* The frame kept in the window reaches the peer once it is back */
+	pipes.forward.dropEvery = 0;
+	for(uint32_t round = 0; round < RETRANSMIT * 2 && b.received == 0; round++)
+	{
+		TP_Poll(&b.obj);
+		TP_Poll(&a.obj);
+		pipeNow++;
+	}
+	TP_Poll(&a.obj);
+
+	if(b.received != 1 || TP_Send(&a.obj, 1, payload, sizeof(payload)) == false || context->arq.status != TPSuccess)
+	{
+		printf("ARQ give up : not recovered, received %u, status %d\n", b.received, context->tx.status);
+		return false;
+	}
+
+	printf("ARQ give up : Aproved!\n");
+	return true;
+}
+
+static bool TestSingleTrial(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+	uint8_t payload[8] = { 0 };
+
+	PipePairInit(&pipes);
+	pipes.forward.dropEvery = 1;
+
+	/* The first frame is still in flight, it didn't time out */
+	bool ret = ArqInit(&a, &pipes.a, 4, 1) && ArqInit(&b, &pipes.b, 4, 1);
+	ret = ret && TP_Send(&a.obj, 1, payload, 4);
+	TP_Int32ToArray(1, payload);
+	ret = ret && TP_Send(&a.obj, 1, payload, 5);
+
+	/* Down once its only transmission timed out */
+	for(uint32_t round = 0; round <= RETRANSMIT + 1; round++)
+	{
+		TP_Poll(&a.obj);
+		pipeNow++;
+	}
+	TP_Context *context = a.obj.handle;
+	ret = ret && context->arq.status == TPTimeout;
+
+	pipes.forward.dropEvery = 0;
+	for(uint32_t round = 0; round < RETRANSMIT * 2 && b.received < 2; round++)
+	{
+		TP_Poll(&b.obj);
+		TP_Poll(&a.obj);
+		pipeNow++;
+	}
+	TP_Poll(&a.obj);
+	ret = ret && b.received == 2 && b.errors == 0 && context->arq.status == TPSuccess;
+
+	printf("ARQ 1 trial : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestLargest(void)
+{
+	static PipePair pipes;
+	static uint8_t window[2 * (UINT16_MAX + LINK_ARQ_SLOT_SIZE)];
+	static uint8_t payload[UINT16_MAX];
+	static Link a;
+
+	PipePairInit(&pipes);
+
+	/* With its header the frame would overflow the 16 bits size */
+	bool ret = ArqInit(&a, &pipes.a, 1, TP_TRIALS_AMOUNT) &&
+			TP_SetArq(&a.obj, window, sizeof(window), 1, RETRANSMIT, TP_TRIALS_AMOUNT);
+	TP_Context *context = a.obj.handle;
+
+	ret = ret && TP_Send(&a.obj, 1, payload, UINT16_MAX - 1) == false && context->tx.status == TPBufferOverflow;
+	ret = ret && pipes.forward.tail == 0;
+	ret = ret && TP_Send(&a.obj, 1, payload, UINT16_MAX - 2);
+	ret = ret && TP_ArrayToInt16((&pipes.forward.data[3])) == UINT16_MAX;
+
+	printf("ARQ largest : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestSlots(void)
+{
+	static PipePair pipes;
+	static Link a;
+
+	PipePairInit(&pipes);
+
+	/* Reordered payloads can't be held in a slot */
+	bool ret = ArqInit(&a, &pipes.a, 4, TP_TRIALS_AMOUNT) && TP_SetRxSlots(&a.obj, 2) == false;
+	ret = ret && TP_SetArq(&a.obj, NULL, 0, 0, 0, TP_TRIALS_AMOUNT) && TP_SetRxSlots(&a.obj, 2);
+	ret = ret && TP_SetArq(&a.obj, a.window, sizeof(a.window), 4, RETRANSMIT, TP_TRIALS_AMOUNT) == false;
+
+	printf("ARQ slots   : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	static const uint8_t windows[] = { 1, 2, 3, 5, 6, 8, 12, 16, 32 };
+	bool lossy = true;
+	bool ret = true;
+
+	for(uint8_t i = 0; i < sizeof(windows); i++)
+	{
+		lossy &= TestLossyLink(windows[i]);
+	}
+	printf("ARQ lossy   : %s\n", lossy ? "Aproved!" : "failed");
+
+	ret &= lossy;
+	ret &= TestGiveUp();
+	ret &= TestSingleTrial();
+	ret &= TestLargest();
+	ret &= TestSlots();
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,254 @@
+/*!
+ * @file Bench.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  CRC throughput, parser cost per frame, TP_Send cost and echo round trips
+ *  by payload size, reported as JSON by make bench.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include <CRC16.h>
+#include <CRC32.h>
+#include <CRC8.h>
+#include <Clmul.h>
+#include "BenchReport.h"
+
+#define PAYLOAD_MAX		4096
+#define STREAM_SIZE		(64 * 1024)
+#define BATCH			16
+
+typedef struct
+{
+	TP_Obj obj;
+	uint8_t buffer[sizeof(TP_Context) + PAYLOAD_MAX];
+	uint8_t tx[PAYLOAD_MAX + 16];
+	uint32_t frames;
+}BenchLink;
+
+static const uint32_t payloadSizes[] = { 8, 64, 256, 1024, 4096 };
+static const uint32_t crcSizes[] = { 16, 64, 256, 1024, 4096, 65536 };
+
+static uint8_t data[65536];
+static uint8_t stream[STREAM_SIZE];
+static uint8_t wire[PAYLOAD_MAX + 16];
+static volatile uint32_t sink;
+
+static void Count(void *param, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	((BenchLink *)param)->frames++;
+}
+
+static void Echo(void *param, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	BenchLink *link = (BenchLink *)param;
+
+	link->frames++;
+	TP_Send(&link->obj, address, payload, size);
+}
+
+/* Copies every byte, as a driver handing the frame to the kernel or a DMA buffer */
+static uint32_t Sink_Write(void *handle, const void *buffer, uint32_t size)
+{
+	memcpy(wire, buffer, size);
+	return size;
+}
+
+static uint32_t Sink_WriteV(void *handle, const TP_IOVec *vector, uint8_t count)
+{
+	uint32_t size = 0;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		memcpy(&wire[size], vector[i].buffer, vector[i].size);
+		size += vector[i].size;
+	}
+	return size;
+}
+
+static uint32_t Sink_Read(void *handle, void *buffer, uint32_t size)
+{
+	return 0;
+}
+
+static uint32_t Sink_Tick(void)
+{
+	return 0;
+}
+
+static TP_Driver sinkDriver;
+
+static void BenchCRC(void)
+{
+	static const char *names[] = { "crc16", "crc16_table", "crc16_clmul", "crc32", "crc32_table", "crc32_clmul", "crc8" };
+	uint32_t algorithms = sizeof(names) / sizeof(names[0]);
+
+	for(uint32_t algorithm = 0; algorithm < algorithms; algorithm++)
+	{
+		if(strstr(names[algorithm], "clmul") != NULL && TPClmulIsSupported() == false)
+		{
+			continue;
+		}
+
+		for(uint32_t s = 0; s < sizeof(crcSizes) / sizeof(crcSizes[0]); s++)
+		{
+			uint32_t size = crcSizes[s];
+			uint64_t bytes = 0;
+			double start = BenchSeconds();
+			double elapsed = 0;
+
+			while((elapsed = BenchSeconds() - start) < BENCH_TIME)
+			{
+				for(uint32_t i = 0; i < BATCH; i++)
+				{
+					switch(algorithm)
+					{
+					case 0: sink += TP_CRC16(data, size); break;
+					case 1: sink += TP_CRC16AddByteTable(data, size, 0); break;
+					case 2: sink += TP_CRC16AddClmul(data, size, 0); break;
+					case 3: sink += TP_CRC32Update(TP_CRC32Init(), data, size); break;
+					case 4: sink += TP_CRC32UpdateByteTable(TP_CRC32Init(), data, size); break;
+					case 5: sink += TP_CRC32UpdateClmul(TP_CRC32Init(), data, size); break;
+					default: sink += TP_CRC8(data, size); break;
+					}
+				}
+				bytes += (uint64_t)size * BATCH;
+			}
+
+			BenchResult(names[algorithm], size, bytes / elapsed / 1e6, "MB/s");
+		}
+	}
+}
+
+/* Frames of a payload size encoded back to back, as the parser sees them */
+static uint32_t BenchStream(uint32_t size, uint32_t *frames)
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * STREAM_SIZE];
+	static BenchLink encoder;
+
+	TP_LoopbackInit(&loopback, queues, sizeof(queues));
+	TP_Init(&encoder.obj, &TP_LoopbackDriver, Count, &encoder, TP_LoopbackPort(&loopback, TP_LOOPBACK_A), 10,
+			encoder.buffer, sizeof(encoder.buffer));
+
+	*frames = 0;
+	while(loopback.queues[0].tail + size + 16 <= STREAM_SIZE && TP_Send(&encoder.obj, 1, data, size))
+	{
+		(*frames)++;
+	}
+
+	return TP_LoopbackDriver.Read((void *)TP_LoopbackPort(&loopback, TP_LOOPBACK_B), stream, STREAM_SIZE);
+}
+
+static void BenchParser(void)
+{
+	static BenchLink link;
+
+	for(uint32_t s = 0; s < sizeof(payloadSizes) / sizeof(payloadSizes[0]); s++)
+	{
+		uint32_t frames = 0;
+		uint32_t length = BenchStream(payloadSizes[s], &frames);
+		double start = 0;
+		double elapsed = 0;
+
+		TP_Init(&link.obj, &sinkDriver, Count, &link, NULL, 10, link.buffer, sizeof(link.buffer));
+		TP_SetOptions(&link.obj, TP_OPTION_STREAMING);
+		link.frames = 0;
+
+		start = BenchSeconds();
+		while((elapsed = BenchSeconds() - start) < BENCH_TIME)
+		{
+			TP_Feed(&link.obj, stream, length);
+		}
+
+		BenchResult("parser", payloadSizes[s], elapsed * 1e9 / link.frames, "ns/frame");
+	}
+}
+
+static void BenchSend(bool staged)
+{
+	static BenchLink link;
+
+	for(uint32_t s = 0; s < sizeof(payloadSizes) / sizeof(payloadSizes[0]); s++)
+	{
+		uint64_t calls = 0;
+		double start = 0;
+		double elapsed = 0;
+
+		TP_Init(&link.obj, &sinkDriver, Count, &link, NULL, 10, link.buffer, sizeof(link.buffer));
+		TP_SetTxBuffer(&link.obj, staged ? link.tx : NULL, staged ? sizeof(link.tx) : 0);
+
+		start = BenchSeconds();
+		while((elapsed = BenchSeconds() - start) < BENCH_TIME)
+		{
+			for(uint32_t i = 0; i < BATCH; i++)
+			{
+				TP_Send(&link.obj, 1, data, payloadSizes[s]);
+			}
+			calls += BATCH;
+		}
+
+		BenchResult(staged ? "tp_send_staged" : "tp_send", payloadSizes[s], elapsed * 1e9 / calls, "ns/call");
+	}
+}
+
+static void BenchRoundTrip(void)
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * 2 * PAYLOAD_MAX];
+	static BenchLink a, b;
+
+	for(uint32_t s = 0; s < sizeof(payloadSizes) / sizeof(payloadSizes[0]); s++)
+	{
+		double start = 0;
+		double elapsed = 0;
+
+		TP_LoopbackInit(&loopback, queues, sizeof(queues));
+		TP_Init(&a.obj, &TP_LoopbackDriver, Count, &a, TP_LoopbackPort(&loopback, TP_LOOPBACK_A), 10,
+				a.buffer, sizeof(a.buffer));
+		TP_Init(&b.obj, &TP_LoopbackDriver, Echo, &b, TP_LoopbackPort(&loopback, TP_LOOPBACK_B), 10,
+				b.buffer, sizeof(b.buffer));
+		a.frames = 0;
+
+		start = BenchSeconds();
+		while((elapsed = BenchSeconds() - start) < BENCH_TIME)
+		{
+			for(uint32_t i = 0; i < BATCH; i++)
+			{
+				TP_Send(&a.obj, 1, data, payloadSizes[s]);
+				TP_Poll(&b.obj);
+				TP_Poll(&a.obj);
+			}
+		}
+
+		BenchResult("tp_roundtrip", payloadSizes[s], elapsed * 1e9 / a.frames, "ns/roundtrip");
+	}
+}
+
+int main(int argc, char** argv)
+{
+	sinkDriver = TP_LoopbackDriver;
+	sinkDriver.Write = Sink_Write;
+	sinkDriver.WriteV = Sink_WriteV;
+	sinkDriver.Read = Sink_Read;
+	sinkDriver.Tick = Sink_Tick;
+
+	for(uint32_t i = 0; i < sizeof(data); i++)
+	{
+		data[i] = (uint8_t)rand();
+	}
+
+	BenchBegin("TransportProtocol", (argc > 1) ? argv[1] : NULL);
+	BenchCRC();
+	BenchParser();
+	BenchSend(false);
+	BenchSend(true);
+	BenchRoundTrip();
+	BenchEnd();
+
+	return 0;
+}
@@ -0,0 +1,46 @@
+/*
+ * BenchReport.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Douglas Reis
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <time.h>
+
+#include "BenchReport.h"
+
+static uint32_t results;
+
+double BenchSeconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void BenchBegin(const char *project, const char *commit)
+{
+	results = 0;
+
+	printf("{\n");
+	printf("  \"project\": \"%s\",\n", project);
+	printf("  \"commit\": \"%s\",\n", (commit != NULL) ? commit : "");
+	printf("  \"results\": [");
+}
+
+void BenchResult(const char *name, uint32_t size, double value, const char *unit)
+{
+	printf("%s\n    {\"name\": \"%s\", \"size\": %u, \"value\": %.3f, \"unit\": \"%s\"}",
+			(results > 0) ? "," : "", name, size, value, unit);
+	fflush(stdout);
+	results++;
+}
+
+void BenchEnd(void)
+{
+	printf("\n  ]\n}\n");
+}
@@ -0,0 +1,46 @@
+/*
+ * BenchReport.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Douglas Reis
+ *
+ *  JSON report shared by the bench executables of TransportProtocol, LDP and
+ *  DVP, one result per line so tools/BenchCompare.py can diff two commits.
+ */
+
+#ifndef TEST_BENCHREPORT_H_
+#define TEST_BENCHREPORT_H_
+
+#include <stdint.h>
+
+#define BENCH_TIME		0.1		/*!< Seconds each measure runs for */
+
+/*!
+ * Monotonic clock in seconds.
+ */
+double BenchSeconds(void);
+
+/*!
+ * Starts the report.
+ *
+ * @param project Project measured.
+ * @param commit  Commit measured, NULL when unknown.
+ */
+void BenchBegin(const char *project, const char *commit);
+
+/*!
+ * Adds a result, its name and size identify it across reports.
+ *
+ * @param name  Measure, e.g. crc16.
+ * @param size  Payload or buffer size in bytes.
+ * @param value Result.
+ * @param unit  MB/s when higher is better, ns/frame, ns/call or ns/roundtrip otherwise.
+ */
+void BenchResult(const char *name, uint32_t size, double value, const char *unit);
+
+/*!
+ * Finishes the report.
+ */
+void BenchEnd(void);
+
+#endif /* TEST_BENCHREPORT_H_ */
@@ -0,0 +1,143 @@
+/*!
+ * @file CRCTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include <CRC16.h>
+#include <CRC32.h>
+#include <CRC8.h>
+#include <Clmul.h>
+
+#define TEST_BUFFER_SIZE 4096
+
+typedef int16_t (*CRC16Method)(uint8_t *data, int32_t length, int16_t crc);
+typedef uint32_t (*CRC32Method)(uint32_t crc, const uint8_t *data, uint32_t length);
+
+static bool TestCRC16(const char *name, CRC16Method method, uint8_t *buffer)
+{
+	/* CRC16/Modbus check value of "123456789" is 0x4B37, byte swapped by TP */
+	uint8_t check[] = "123456789";
+	if((uint16_t)method(check, 9, (int16_t)0xFFFF) != 0x374B)
+	{
+		printf("%-12s: check value failed\n", name);
+		return false;
+	}
+
+	for(int32_t offset = 0; offset < 16; offset++)
+	{
+		for(int32_t length = 0; length <= TEST_BUFFER_SIZE - 16; length += (length < 300) ? 1 : 97)
+		{
+			int16_t crc = (int16_t)rand();
+			int16_t expected = TP_CRC16AddByteTable(&buffer[offset], length, crc);
+			int16_t result = method(&buffer[offset], length, crc);
+			if(result != expected)
+			{
+				printf("%-12s: offset %d length %d expected 0x%04X got 0x%04X\n", name, offset, length,
+						(uint16_t)expected, (uint16_t)result);
+				return false;
+			}
+		}
+	}
+
+	printf("%-12s: Aproved!\n", name);
+	return true;
+}
+
+static bool TestCRC16Copy(uint8_t *buffer)
+{
+	static uint8_t copy[TEST_BUFFER_SIZE];
+
+	for(int32_t length = 0; length <= TEST_BUFFER_SIZE - 16; length += (length < 300) ? 1 : 97)
+	{
+		int16_t crc = (int16_t)rand();
+		int16_t expected = TP_CRC16AddByteTable(&buffer[3], length, crc);
+		memset(copy, 0, sizeof(copy));
+		if(TP_CRC16Copy(&copy[1], &buffer[3], length, crc) != expected || memcmp(&copy[1], &buffer[3], length) != 0)
+		{
+			printf("%-12s: length %d failed\n", "CRC16 Copy", length);
+			return false;
+		}
+	}
+
+	printf("%-12s: Aproved!\n", "CRC16 Copy");
+	return true;
+}
+
+static bool TestCRC32(const char *name, CRC32Method method, uint8_t *buffer)
+{
+	/* CRC32 IEEE check value of "123456789" */
+	uint8_t check[] = "123456789";
+	if(TP_CRC32Final(method(TP_CRC32Init(), check, 9)) != 0xCBF43926)
+	{
+		printf("%-12s: check value failed\n", name);
+		return false;
+	}
+
+	for(uint32_t offset = 0; offset < 16; offset++)
+	{
+		for(uint32_t length = 0; length <= TEST_BUFFER_SIZE - 16; length += (length < 300) ? 1 : 97)
+		{
+			uint32_t crc = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+			uint32_t expected = TP_CRC32UpdateByteTable(crc, &buffer[offset], length);
+			uint32_t result = method(crc, &buffer[offset], length);
+			if(result != expected)
+			{
+				printf("%-12s: offset %u length %u expected 0x%08X got 0x%08X\n", name, offset, length, expected, result);
+				return false;
+			}
+		}
+	}
+
+	printf("%-12s: Aproved!\n", name);
+	return true;
+}
+
+static bool TestCRC8(void)
+{
+	/* CRC-8/SMBUS check value of "123456789" */
+	uint8_t check[] = "123456789";
+	if(TP_CRC8(check, 9) != 0xF4)
+	{
+		printf("%-12s: check value failed\n", "CRC8");
+		return false;
+	}
+
+	printf("%-12s: Aproved!\n", "CRC8");
+	return true;
+}
+
+int main (int argc, char** argv)
+{
+	static uint8_t buffer[TEST_BUFFER_SIZE];
+	bool approved = true;
+
+	srand(1);
+	for(int i = 0; i < sizeof(buffer); i++)
+	{
+		buffer[i] = (uint8_t)rand();
+	}
+
+	approved &= TestCRC16("CRC16", TP_CRC16Add, buffer);
+	approved &= TestCRC16Copy(buffer);
+	approved &= TestCRC32("CRC32", TP_CRC32Update, buffer);
+	approved &= TestCRC8();
+
+#if TP_CRC_CLMUL
+	if(TPClmulIsSupported())
+	{
+		approved &= TestCRC16("CRC16 CLMUL", TP_CRC16AddClmul, buffer);
+		approved &= TestCRC32("CRC32 CLMUL", TP_CRC32UpdateClmul, buffer);
+	}
+	else
+	{
+		printf("CRC16 CLMUL : not supported by this CPU\n");
+	}
+#endif
+
+	return approved ? 0 : 1;
+}
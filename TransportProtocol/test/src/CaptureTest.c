@@ -0,0 +1,103 @@
+/*!
+ * @file CaptureTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Frames sent and received, a corrupted one included, captured to pcapng files
+ *  and read back. The files are left for tools/CaptureDump.py.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+#include "Pcapng.h"
+
+/* A link writing its frames to a pcapng file */
+typedef struct
+{
+	Link link;
+	TPPcapng pcap;
+	uint8_t halves[2 * 4096];
+}Capturing;
+
+static uint8_t payload[128];
+
+/* Counts the enhanced packet blocks of a file by direction and status */
+static uint32_t CountBlocks(const char *path, uint8_t direction, int8_t status)
+{
+	static uint8_t data[16 * 1024];
+	FILE *file = fopen(path, "rb");
+	uint32_t size = 0;
+	uint32_t count = 0;
+
+	if(file != NULL)
+	{
+		size = fread(data, 1, sizeof(data), file);
+		fclose(file);
+	}
+
+	for(uint32_t offset = 0; offset + 8 <= size; )
+	{
+		uint32_t type = 0;
+		uint32_t length = 0;
+
+		memcpy(&type, &data[offset], sizeof(type));
+		memcpy(&length, &data[offset + 4], sizeof(length));
+
+		/* Pseudo header right after the 28 bytes of the block header */
+		if(type == 6 && data[offset + 28] == direction && (int8_t)data[offset + 30] == status)
+		{
+			count++;
+		}
+
+		offset += (length != 0) ? length : size;
+	}
+
+	return count;
+}
+
+static bool CapturingInit(Capturing *capturing, Port *port, const char *path)
+{
+	return LinkInit(&capturing->link, port, NULL) &&
+			TPPcapngOpen(&capturing->pcap, path, capturing->halves, sizeof(capturing->halves)) &&
+			TP_SetCapture(&capturing->link.obj, TPPcapngCapture, &capturing->pcap);
+}
+
+static bool CapturingClose(Capturing *capturing)
+{
+	return TP_SetCapture(&capturing->link.obj, NULL, NULL) && TPPcapngClose(&capturing->pcap);
+}
+
+int main(int argc, char** argv)
+{
+	static PipePair pipes;
+	static Capturing a, b;
+	char sent[256], received[256];
+	bool ret = false;
+
+	snprintf(sent, sizeof(sent), "%s/sent.pcapng", (argc > 1) ? argv[1] : ".");
+	snprintf(received, sizeof(received), "%s/received.pcapng", (argc > 1) ? argv[1] : ".");
+
+	PipePairInit(&pipes);
+	ret = CapturingInit(&a, &pipes.a, sent) && CapturingInit(&b, &pipes.b, received) &&
+			TP_SetOptions(&b.link.obj, TP_OPTION_STREAMING);
+
+	/* Frame 5 gets corrupted on its way */
+	for(uint32_t i = 0; ret && i < 20; i++)
+	{
+		pipes.forward.corruptEvery = (i == 5) ? 1 : 0;
+		ret = TP_Send(&a.link.obj, 1, payload, sizeof(payload));
+		TP_Poll(&b.link.obj);
+	}
+
+	ret = ret && CapturingClose(&a) && CapturingClose(&b);
+	ret = ret && a.pcap.dropped == 0 && b.pcap.dropped == 0 && a.pcap.captured == 20 && b.pcap.captured == 20;
+	ret = ret && CountBlocks(sent, TP_CAPTURE_TX, TPSuccess) == 20;
+	ret = ret && CountBlocks(received, TP_CAPTURE_RX, TPSuccess) == 19 &&
+			CountBlocks(received, TP_CAPTURE_RX, TPErrorChecksum) == 1;
+
+	printf("Capture     : %s\n", ret ? "Aproved!" : "failed");
+	return ret ? 0 : 1;
+}
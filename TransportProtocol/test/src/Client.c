@@ -27,11 +27,13 @@ TP_Driver driver =
 		.Close = UART_Close,
 		.Flush = UART_Flush,
 		.Tick = SYS_Tick,
-		.Sleep = SYS_Sleep
+		.Sleep = SYS_Sleep,
+		.Wait = UART_Wait,
+		.WriteV = UART_WriteV
 };
 
 
-void Callback(void *param, uint8_t address, uint16_t size, uint8_t *payload)
+void Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
 {
 	ClassTest *test = (ClassTest*) param;
 	test->running = false;
@@ -74,7 +76,10 @@ int main (int argc, char** argv)
 			test.running = true;
 			while(test.running)
 			{
-				TP_Process(&test.obj);
+				if(TP_Poll(&test.obj) == TPIsRunning)
+				{
+					UART_Wait(NULL, test.timeout);
+				}
 				if(	test.timeout < SYS_Tick())
 				{
 					printf("\nTimeout: %d\n", test.timeout);		
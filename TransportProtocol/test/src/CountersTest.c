@@ -0,0 +1,78 @@
+/*!
+ * @file CountersTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Link counters and histograms after frames received, corrupted, too large
+ *  and abandoned by the peer, and the driver reads of a starving poll.
+ */
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+#define TOO_LARGE		(LINK_PAYLOAD_SIZE + 44)
+
+static uint8_t payload[TOO_LARGE];
+
+/* Every callback takes 3 ticks */
+static bool Check(Link *link, uint32_t size, const uint8_t *data)
+{
+	pipeNow += 3;
+	return true;
+}
+
+static uint32_t Sum(const uint32_t *histogram)
+{
+	uint32_t sum = 0;
+
+	for(uint32_t i = 0; i < TP_HISTOGRAM_BUCKETS; i++)
+	{
+		sum += histogram[i];
+	}
+	return sum;
+}
+
+int main(int argc, char** argv)
+{
+	static PipePair pipes;
+	static Link a, b;
+	static TPHistograms histograms;
+	TPCounters counters = { 0 };
+
+	PipePairInit(&pipes);
+	bool ret = LinkInit(&a, &pipes.a, Check) && LinkInit(&b, &pipes.b, Check) &&
+			TP_SetOptions(&b.obj, TP_OPTION_STREAMING) && TP_SetHistograms(&b.obj, &histograms);
+
+	/* Received, corrupted and too large */
+	ret = ret && TP_Send(&a.obj, 1, payload, 100) && TP_Send(&a.obj, 1, payload, 20);
+	pipes.forward.corruptEvery = 1;
+	ret = ret && TP_Send(&a.obj, 1, payload, 30);
+	pipes.forward.corruptEvery = 0;
+	ret = ret && TP_Send(&a.obj, 1, payload, TOO_LARGE) && TP_Send(&a.obj, 1, payload, 44) && TP_Send(&a.obj, 1, payload, 10);
+	TP_Poll(&b.obj);
+
+	/* Abandoned in the middle */
+	ret = ret && TP_Send(&a.obj, 1, payload, 40);
+	pipes.forward.tail -= 10;
+	TP_Poll(&b.obj);
+
+	/* A starving poll reads the driver once */
+	pipes.forward.reads = 0;
+	ret = ret && TP_Poll(&b.obj) == TPIsRunning && pipes.forward.reads == 1;
+	pipeNow += LINK_TIMEOUT + 1;
+	TP_Poll(&b.obj);
+
+	ret = ret && TP_GetCounters(&a.obj, &counters) && counters.framesSent == 7 && counters.bytesSent == 7 * 7 + 100 + 20 + 30 + TOO_LARGE + 44 + 10 + 40;
+	ret = ret && TP_GetCounters(&b.obj, &counters);
+	ret = ret && counters.framesReceived == 4 && counters.bytesReceived == 100 + 20 + 44 + 10;
+	ret = ret && counters.crcErrors == 1 && counters.overflows == 1 && counters.timeouts == 1;
+	ret = ret && Sum(histograms.receiveTime) == 4 && Sum(histograms.callbackTime) == 4 && histograms.callbackTime[2] == 4;
+
+	ret = ret && TP_ResetCounters(&b.obj) && TP_GetCounters(&b.obj, &counters) && counters.framesReceived == 0;
+	ret = ret && Sum(histograms.callbackTime) == 0;
+
+	printf("Counters    : %s\n", ret ? "Aproved!" : "failed");
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,228 @@
+/*!
+ * @file DatagramTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Frames received one per datagram by a driver with TP_DRIVER_DATAGRAM:
+ *  plain, jumbo with the header check, malformed and in the reliable mode.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+
+#define DATAGRAMS		16
+#define DATAGRAM_SIZE	(80 * 1024)
+#define BLOB_SIZE		(70 * 1024)
+#define WINDOW			4
+
+typedef struct
+{
+	uint8_t data[DATAGRAMS][DATAGRAM_SIZE];
+	uint32_t length[DATAGRAMS];
+	uint32_t head;
+	uint32_t tail;
+}Queue;
+
+typedef struct
+{
+	Queue *in;
+	Queue *out;
+}Channel;
+
+typedef struct
+{
+	TP_Obj obj;
+	uint8_t buffer[sizeof(TP_Context) + DATAGRAM_SIZE];
+	uint8_t txBuffer[DATAGRAM_SIZE];
+	uint8_t window[2 * WINDOW * 128];
+	uint32_t received;
+	uint32_t size;
+}Link;
+
+static uint8_t blob[BLOB_SIZE];
+static uint32_t now;
+
+static void *Datagram_Open(const void *port)
+{
+	return (void *)port;
+}
+
+static uint16_t Datagram_Close(void *handle)
+{
+	return 0;
+}
+
+static void Datagram_Flush(void *handle)
+{
+}
+
+static uint32_t Datagram_Read(void *handle, void *buffer, uint32_t size)
+{
+	Queue *queue = ((Channel *)handle)->in;
+	uint32_t count = 0;
+
+	if(queue->head != queue->tail)
+	{
+		count = queue->length[queue->head % DATAGRAMS];
+		count = (count > size) ? size : count;
+		memcpy(buffer, queue->data[queue->head % DATAGRAMS], count);
+		queue->head++;
+	}
+	return count;
+}
+
+static uint32_t Datagram_Write(void *handle, const void *buffer, uint32_t size)
+{
+	Queue *queue = ((Channel *)handle)->out;
+
+	if(queue->tail - queue->head == DATAGRAMS || size > DATAGRAM_SIZE)
+	{
+		return (uint32_t)-1;
+	}
+
+	memcpy(queue->data[queue->tail % DATAGRAMS], buffer, size);
+	queue->length[queue->tail % DATAGRAMS] = size;
+	queue->tail++;
+
+	return size;
+}
+
+static uint32_t Datagram_Tick(void)
+{
+	return now;
+}
+
+static void Datagram_Sleep(uint32_t time)
+{
+}
+
+static TP_Driver driver =
+{
+		.Open = Datagram_Open,
+		.Write = Datagram_Write,
+		.Read = Datagram_Read,
+		.Close = Datagram_Close,
+		.Flush = Datagram_Flush,
+		.Tick = Datagram_Tick,
+		.Sleep = Datagram_Sleep,
+		.capabilities = TP_DRIVER_DATAGRAM
+};
+
+static void Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	Link *link = (Link *)param;
+
+	link->received++;
+	link->size = size;
+	if(size > BLOB_SIZE || memcmp(payload, blob, size) != 0)
+	{
+		link->size = 0;
+	}
+}
+
+static bool LinkInit(Link *link, Channel *channel, uint32_t options)
+{
+	memset(link, 0, sizeof(Link));
+
+	/* One write per frame */
+	return TP_Init(&link->obj, &driver, Callback, link, channel, 1000, link->buffer, sizeof(link->buffer)) &&
+			TP_SetTxBuffer(&link->obj, link->txBuffer, sizeof(link->txBuffer)) &&
+			TP_SetOptions(&link->obj, TP_OPTION_STREAMING | options);
+}
+
+static bool TestFrames(void)
+{
+	static Queue forward, backward;
+	static Channel channelA = { .in = &backward, .out = &forward };
+	static Channel channelB = { .in = &forward, .out = &backward };
+	static Link a, b;
+	TPCounters counters = { 0 };
+	bool ret = LinkInit(&a, &channelA, 0) && LinkInit(&b, &channelB, 0);
+
+	for(uint32_t i = 0; ret && i < 10; i++)
+	{
+		ret = TP_Send(&a.obj, 1, blob, i * 100);
+	}
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 10 && b.size == 900;
+
+	/* Junk, a truncated frame and a corrupted one, the following frame is still received */
+	ret = ret && Datagram_Write(&channelA, "junk", 4) == 4;
+	ret = ret && TP_Send(&a.obj, 1, blob, 10) && (forward.length[(forward.tail - 1) % DATAGRAMS]--, true);
+	ret = ret && TP_Send(&a.obj, 1, blob, 10) && (forward.data[(forward.tail - 1) % DATAGRAMS][6] ^= 0x01, true);
+	ret = ret && TP_Send(&a.obj, 1, blob, 20);
+	TP_Poll(&b.obj);
+	TP_GetCounters(&b.obj, &counters);
+	ret = ret && b.received == 11 && b.size == 20 && counters.resyncs == 2 && counters.skippedBytes == 4 + 16;
+
+	printf("Datagram    : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestJumbo(void)
+{
+	static Queue forward, backward;
+	static Channel channelA = { .in = &backward, .out = &forward };
+	static Channel channelB = { .in = &forward, .out = &backward };
+	static Link a, b;
+	uint32_t options = TP_OPTION_JUMBO | TP_OPTION_HEADER_CHECK;
+	bool ret = LinkInit(&a, &channelA, options) && LinkInit(&b, &channelB, options);
+
+	ret = ret && TP_Send(&a.obj, 1, blob, BLOB_SIZE) && TP_Send(&a.obj, 1, blob, 10);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 2 && b.size == 10;
+
+	ret = ret && TP_Send(&a.obj, 1, blob, BLOB_SIZE);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 3 && b.size == BLOB_SIZE;
+
+	printf("Datagram jmb: %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestReliable(void)
+{
+	static Queue forward, backward;
+	static Channel channelA = { .in = &backward, .out = &forward };
+	static Channel channelB = { .in = &forward, .out = &backward };
+	static Link a, b;
+	uint32_t sent = 0;
+	bool ret = LinkInit(&a, &channelA, 0) && LinkInit(&b, &channelB, 0) &&
+			TP_SetArq(&a.obj, a.window, sizeof(a.window), WINDOW, 20, TP_TRIALS_AMOUNT) &&
+			TP_SetArq(&b.obj, b.window, sizeof(b.window), WINDOW, 20, TP_TRIALS_AMOUNT);
+
+	for(uint32_t round = 0; ret && round < 1000 && b.received < 20; round++)
+	{
+		if(sent < 20 && TP_Send(&a.obj, 1, blob, 50 + sent) == true)
+		{
+			sent++;
+		}
+
+		TP_Poll(&b.obj);
+		TP_Poll(&a.obj);
+		now++;
+	}
+
+	ret = ret && b.received == 20 && b.size == 69;
+
+	printf("Datagram ARQ: %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	bool ret = true;
+
+	for(uint32_t i = 0; i < BLOB_SIZE; i++)
+	{
+		blob[i] = (uint8_t)rand();
+	}
+
+	ret &= TestFrames();
+	ret &= TestJumbo();
+	ret &= TestReliable();
+
+	return ret ? 0 : 1;
+}
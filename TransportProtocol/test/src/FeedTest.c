@@ -0,0 +1,110 @@
+/*!
+ * @file FeedTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Frames pushed to the parser with TP_Feed in pieces of any size, and held
+ *  back while the application owns every RX slot.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+#define FRAMES			50
+
+static uint8_t blob[512];
+
+static bool Check(Link *link, uint32_t size, const uint8_t *payload)
+{
+	return size == link->received % 300 && memcmp(payload, blob, size) == 0;
+}
+
+/* The stream sent by a peer, frame i has i % 300 bytes */
+static Pipe *Capture(uint32_t frames)
+{
+	static PipePair pipes;
+	static Link sender;
+
+	PipePairInit(&pipes);
+	LinkInit(&sender, &pipes.a, NULL);
+	for(uint32_t i = 0; i < frames; i++)
+	{
+		TP_Send(&sender.obj, 1, blob, i % 300);
+	}
+
+	return &pipes.forward;
+}
+
+static bool TestPieces(void)
+{
+	static PipePair idle;
+	static Link link;
+	Pipe *stream = Capture(FRAMES);
+	uint32_t offset = 0;
+
+	PipePairInit(&idle);
+	bool ret = LinkInit(&link, &idle.b, Check);
+
+	/* Junk before the first frame */
+	ret = ret && TP_Feed(&link.obj, (const uint8_t *)"\x5A\x00junk", 6) == 6;
+
+	while(ret && offset < stream->tail)
+	{
+		uint32_t piece = 1 + rand() % 200;
+		piece = (piece > stream->tail - offset) ? stream->tail - offset : piece;
+
+		ret = TP_Feed(&link.obj, &stream->data[offset], piece) == piece;
+		offset += piece;
+	}
+
+	ret = ret && link.received == FRAMES && link.errors == 0;
+
+	printf("Feed        : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestSlots(void)
+{
+	static PipePair idle;
+	static Link link;
+	Pipe *stream = Capture(FRAMES);
+	uint32_t parsed = 0;
+
+	PipePairInit(&idle);
+	bool ret = LinkInit(&link, &idle.b, Check) && TP_SetRxSlots(&link.obj, 2);
+
+	/* The frames after the second one wait for a slot, as much as fits the staging area is taken */
+	parsed = TP_Feed(&link.obj, stream->data, stream->tail);
+	ret = ret && parsed < stream->tail && link.received == 2;
+
+	/* Each payload released lets one more frame in */
+	for(uint32_t i = 0; ret && link.received < FRAMES; i++)
+	{
+		ret = TP_Release(&link.obj, link.payloads[i]);
+		parsed += TP_Feed(&link.obj, &stream->data[parsed], stream->tail - parsed);
+		ret = ret && link.received == i + 3;
+	}
+
+	ret = ret && parsed == stream->tail && link.errors == 0;
+
+	printf("Feed slots  : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	bool ret = true;
+
+	for(uint32_t i = 0; i < sizeof(blob); i++)
+	{
+		blob[i] = (uint8_t)rand();
+	}
+
+	ret &= TestPieces();
+	ret &= TestSlots();
+
+	return ret ? 0 : 1;
+}
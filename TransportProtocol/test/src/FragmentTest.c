@@ -0,0 +1,128 @@
+/*!
+ * @file FragmentTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Payloads larger than the RX buffer and than a frame, sent in fragments and
+ *  reassembled, with and without the reliable mode.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+#define FRAGMENT_SIZE	64
+#define BLOB_SIZE		(70 * 1024)
+#define WINDOW			16
+
+static uint8_t blob[BLOB_SIZE];
+static uint8_t reassembly[BLOB_SIZE];
+
+static bool Check(Link *link, uint32_t size, const uint8_t *payload)
+{
+	return size <= BLOB_SIZE && memcmp(payload, blob, size) == 0;
+}
+
+/* Fragments fit a window slot of the pipe links */
+static bool FragmentInit(Link *link, Port *port, uint32_t reassemblySize, bool arq)
+{
+	return LinkInit(link, port, Check) &&
+			TP_SetTxBuffer(&link->obj, link->txBuffer, sizeof(link->txBuffer)) &&
+			TP_SetOptions(&link->obj, TP_OPTION_STREAMING) &&
+			TP_SetFragmentation(&link->obj, FRAGMENT_SIZE, reassembly, reassemblySize) &&
+			(arq == false || TP_SetArq(&link->obj, link->window, 2 * WINDOW * LINK_ARQ_SLOT_SIZE, WINDOW, 20, TP_TRIALS_AMOUNT));
+}
+
+static bool TestPlain(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+
+	PipePairInit(&pipes);
+	bool ret = FragmentInit(&a, &pipes.a, 0, false) && FragmentInit(&b, &pipes.b, BLOB_SIZE, false);
+
+	/* Larger than a frame */
+	ret = ret && TP_Send(&a.obj, 1, blob, BLOB_SIZE);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 1 && b.errors == 0 && b.size == BLOB_SIZE;
+
+	/* A lost fragment drops the payload, the next one is received */
+	pipes.forward.dropEvery = 5;
+	ret = ret && TP_Send(&a.obj, 1, blob, 1000);
+	pipes.forward.dropEvery = 0;
+	ret = ret && TP_Send(&a.obj, 1, blob, 10) && TP_Send(&a.obj, 1, blob, 0);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 3 && b.errors == 0 && b.size == 0;
+
+	/* Larger than the reassembly buffer */
+	ret = ret && FragmentInit(&b, &pipes.b, 100, false) && TP_Send(&a.obj, 1, blob, 101) && TP_Send(&a.obj, 1, blob, 100);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 1 && b.errors == 0 && b.size == 100;
+
+	printf("Fragment    : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestReliable(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+	uint32_t sent = 0;
+
+	PipePairInit(&pipes);
+	pipes.forward.dropEvery = 7;
+	pipes.backward.dropEvery = 5;
+	bool ret = FragmentInit(&a, &pipes.a, 0, true) && FragmentInit(&b, &pipes.b, BLOB_SIZE, true);
+
+	for(uint32_t round = 0; ret && round < 100000 && b.received < 20; round++)
+	{
+		if(sent < 20 && TP_Send(&a.obj, 1, blob, 500 + sent) == true)
+		{
+			sent++;
+		}
+
+		TP_Poll(&b.obj);
+		TP_Poll(&a.obj);
+		pipeNow++;
+	}
+
+	ret = ret && b.received == 20 && b.errors == 0 && b.size == 519;
+
+	printf("Fragment ARQ: %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestSlots(void)
+{
+	static PipePair pipes;
+	static Link a;
+
+	PipePairInit(&pipes);
+
+	/* Reassembled payloads can't be held in a slot */
+	bool ret = FragmentInit(&a, &pipes.a, BLOB_SIZE, false) && TP_SetRxSlots(&a.obj, 2) == false;
+	ret = ret && TP_SetFragmentation(&a.obj, FRAGMENT_SIZE, NULL, 0) && TP_SetRxSlots(&a.obj, 2);
+	ret = ret && TP_SetFragmentation(&a.obj, FRAGMENT_SIZE, reassembly, BLOB_SIZE) == false;
+
+	printf("Frag slots  : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	bool ret = true;
+
+	for(uint32_t i = 0; i < BLOB_SIZE; i++)
+	{
+		blob[i] = (uint8_t)rand();
+	}
+
+	ret &= TestPlain();
+	ret &= TestReliable();
+	ret &= TestSlots();
+
+	return ret ? 0 : 1;
+}
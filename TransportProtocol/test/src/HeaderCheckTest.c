@@ -0,0 +1,48 @@
+/*!
+ * @file HeaderCheckTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  A frame whose size field was corrupted is dropped by the header check at
+ *  once, instead of swallowing the frames which follow it.
+ */
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+static uint8_t payload[1024];
+
+/* Sends two frames, the size of the first one grows from 100 to 356 bytes on the way */
+static bool Receive(uint32_t options, TPCounters *counters)
+{
+	static PipePair pipes;
+	static Link a, b;
+
+	PipePairInit(&pipes);
+	if(LinkInit(&a, &pipes.a, NULL) && LinkInit(&b, &pipes.b, NULL) &&
+	   TP_SetOptions(&a.obj, TP_OPTION_STREAMING | options) && TP_SetOptions(&b.obj, TP_OPTION_STREAMING | options) &&
+	   TP_Send(&a.obj, 1, payload, 100) && TP_Send(&a.obj, 1, payload, 10))
+	{
+		pipes.forward.data[3] ^= 0x01;
+
+		TP_Poll(&b.obj);
+		TP_GetCounters(&b.obj, counters);
+	}
+
+	return b.received == 1 && b.size == 10;
+}
+
+int main(int argc, char** argv)
+{
+	TPCounters counters = { 0 };
+	bool ret = true;
+
+	/* Without the check the parser waits for the corrupted size */
+	ret &= Receive(0, &counters) == false;
+	ret &= Receive(TP_OPTION_HEADER_CHECK, &counters) == true && counters.badHeaders == 1;
+
+	printf("Header check: %s\n", ret ? "Aproved!" : "failed");
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/*!
+ * @file JumboTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Payloads above 65535 bytes sent in a single jumbo frame, mixed with
+ *  standard frames, and ignored by a receiver which didn't enable them.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+#define BLOB_SIZE		(200 * 1024)
+
+static uint8_t blob[BLOB_SIZE];
+static const uint8_t zeros[BLOB_SIZE];
+static uint8_t buffer[sizeof(TP_Context) + BLOB_SIZE];
+
+static bool Check(Link *link, uint32_t size, const uint8_t *payload)
+{
+	return size <= BLOB_SIZE && memcmp(payload, blob, size) == 0;
+}
+
+/* The receiver gets a RX buffer large enough for the blob */
+static bool JumboInit(Link *link, Port *port, uint32_t options, bool large)
+{
+	return (large ? LinkInitBuffer(link, port, Check, buffer, sizeof(buffer)) : LinkInit(link, port, Check)) &&
+			TP_SetOptions(&link->obj, TP_OPTION_STREAMING | options);
+}
+
+static bool TestJumbo(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+
+	PipePairInit(&pipes);
+	bool ret = JumboInit(&a, &pipes.a, TP_OPTION_JUMBO, false) && JumboInit(&b, &pipes.b, TP_OPTION_JUMBO, true);
+
+	/* One frame, followed by a standard one */
+	ret = ret && TP_Send(&a.obj, 1, blob, BLOB_SIZE) && TP_Send(&a.obj, 1, blob, 10);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 2 && b.errors == 0 && b.largest == BLOB_SIZE && b.size == 10;
+
+	/* Larger than the RX buffer */
+	ret = ret && JumboInit(&b, &pipes.b, TP_OPTION_JUMBO, true) && TP_SetRxSlots(&b.obj, 2);
+	ret = ret && TP_Send(&a.obj, 1, zeros, BLOB_SIZE) && TP_Send(&a.obj, 1, blob, 10);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 1 && b.errors == 0 && b.size == 10;
+
+	printf("Jumbo       : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestNotAgreed(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+
+	PipePairInit(&pipes);
+	bool ret = JumboInit(&a, &pipes.a, TP_OPTION_JUMBO, false) && JumboInit(&b, &pipes.b, 0, true);
+
+	/* Too large for a standard frame */
+	ret = ret && TP_Send(&b.obj, 1, blob, UINT16_MAX + 1) == false;
+
+	/* The receiver skips the jumbo frame as junk */
+	ret = ret && TP_Send(&a.obj, 1, zeros, BLOB_SIZE) && TP_Send(&a.obj, 1, blob, 10);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == 1 && b.errors == 0 && b.size == 10;
+
+	printf("Jumbo off   : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	bool ret = true;
+
+	for(uint32_t i = 0; i < BLOB_SIZE; i++)
+	{
+		blob[i] = (uint8_t)rand();
+	}
+
+	ret &= TestJumbo();
+	ret &= TestNotAgreed();
+
+	return ret ? 0 : 1;
+}
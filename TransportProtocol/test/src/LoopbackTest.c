@@ -0,0 +1,129 @@
+/*!
+ * @file LoopbackTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Two links over the loopback driver: frames wrapping around small queues,
+ *  short writes to a full queue and a blocking wait served by the idle hook.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+
+typedef struct
+{
+	TP_Obj obj;
+	uint8_t buffer[sizeof(TP_Context) + 256];
+	uint32_t received;
+	uint32_t size;
+	bool echo;
+}Link;
+
+static uint8_t payload[200];
+
+static void Callback(void *param, uint8_t address, uint32_t size, uint8_t *data)
+{
+	Link *link = (Link *)param;
+
+	link->received++;
+	link->size = (memcmp(data, payload, size) == 0) ? size : 0;
+
+	if(link->echo)
+	{
+		TP_Send(&link->obj, address, data, size);
+	}
+}
+
+static void Idle(void *param)
+{
+	TP_Poll(&((Link *)param)->obj);
+}
+
+static bool LinkInit(Link *link, TP_Loopback *loopback, uint8_t side)
+{
+	memset(link, 0, sizeof(Link));
+
+	return TP_Init(&link->obj, &TP_LoopbackDriver, Callback, link, TP_LoopbackPort(loopback, side), 1000,
+			link->buffer, sizeof(link->buffer));
+}
+
+static bool TestWrapAround(void)
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * 256];
+	static Link a, b;
+	bool ret = TP_LoopbackInit(&loopback, queues, sizeof(queues)) &&
+			LinkInit(&a, &loopback, TP_LOOPBACK_A) && LinkInit(&b, &loopback, TP_LOOPBACK_B);
+
+	/* Frames of every size, crossing the end of the 256 bytes queue */
+	for(uint32_t size = 1; ret && size <= sizeof(payload); size += 7)
+	{
+		ret = TP_Send(&a.obj, 1, payload, size) && TP_Poll(&b.obj) == TPSuccess && b.size == size;
+	}
+
+	printf("Loopback    : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestFull(void)
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * 128];
+	static Link a, b;
+	bool ret = TP_LoopbackInit(&loopback, queues, sizeof(queues)) &&
+			LinkInit(&a, &loopback, TP_LOOPBACK_A) && LinkInit(&b, &loopback, TP_LOOPBACK_B);
+
+	/* A short write, then nothing until the peer reads */
+	ret = ret && TP_LoopbackDriver.Write((void *)TP_LoopbackPort(&loopback, TP_LOOPBACK_A), payload, sizeof(payload)) == 128;
+	ret = ret && TP_LoopbackDriver.Write((void *)TP_LoopbackPort(&loopback, TP_LOOPBACK_A), payload, 1) == 0;
+	TP_LoopbackDriver.Flush((void *)TP_LoopbackPort(&loopback, TP_LOOPBACK_B));
+
+	/* A frame larger than the queue gives up after the timeout */
+	ret = ret && TP_Send(&a.obj, 1, payload, sizeof(payload)) == false;
+	TP_LoopbackDriver.Flush((void *)TP_LoopbackPort(&loopback, TP_LOOPBACK_B));
+
+	ret = ret && TP_Send(&a.obj, 1, payload, 100) && TP_Poll(&b.obj) == TPSuccess && b.size == 100;
+
+	printf("Loopback ful: %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+static bool TestIdle(void)
+{
+	static TP_Loopback loopback;
+	static uint8_t queues[2 * 1024];
+	static Link a, b;
+	bool ret = TP_LoopbackInit(&loopback, queues, sizeof(queues)) &&
+			LinkInit(&a, &loopback, TP_LOOPBACK_A) && LinkInit(&b, &loopback, TP_LOOPBACK_B) &&
+			TP_LoopbackSetIdle(&loopback, TP_LOOPBACK_A, Idle, &b);
+
+	/* The blocking TP_Process of A runs B, which echoes the frame */
+	b.echo = true;
+	for(uint32_t i = 0; ret && i < 10; i++)
+	{
+		ret = TP_Send(&a.obj, 1, payload, 50 + i);
+		TP_Process(&a.obj);
+		ret = ret && a.received == i + 1 && a.size == 50 + i;
+	}
+
+	printf("Loopback idl: %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	bool ret = true;
+
+	for(uint32_t i = 0; i < sizeof(payload); i++)
+	{
+		payload[i] = (uint8_t)rand();
+	}
+
+	ret &= TestWrapAround();
+	ret &= TestFull();
+	ret &= TestIdle();
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+/*
+ * Pipe.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Douglas Reis
+ */
+
+#include "Pipe.h"
+
+uint32_t pipeNow;
+
+static void *Pipe_Open(const void *port)
+{
+	return (void *)port;
+}
+
+static uint16_t Pipe_Close(void *handle)
+{
+	return 0;
+}
+
+static void Pipe_Flush(void *handle)
+{
+}
+
+static uint32_t Pipe_Read(void *handle, void *buffer, uint32_t size)
+{
+	Pipe *pipe = ((Port *)handle)->in;
+	uint32_t count = pipe->tail - pipe->head;
+
+	pipe->reads++;
+	count = (count > size) ? size : count;
+	memcpy(buffer, &pipe->data[pipe->head], count);
+	pipe->head += count;
+
+	if(pipe->head == pipe->tail)
+	{
+		pipe->head = 0;
+		pipe->tail = 0;
+	}
+	return count;
+}
+
+static uint32_t Pipe_Write(void *handle, const void *buffer, uint32_t size)
+{
+	Pipe *pipe = ((Port *)handle)->out;
+
+	pipe->writes++;
+	if(pipe->dropEvery && (pipe->writes % pipe->dropEvery) == 0)
+	{
+		return size;
+	}
+
+	/* Full pipe is an error, a short write would wait for a clock which doesn't move */
+	if(pipe->tail + size > PIPE_SIZE)
+	{
+		return (uint32_t)-1;
+	}
+
+	memcpy(&pipe->data[pipe->tail], buffer, size);
+	if(pipe->corruptEvery && (pipe->writes % pipe->corruptEvery) == 0)
+	{
+		pipe->data[pipe->tail + size - 3] ^= 0x10;
+	}
+	pipe->tail += size;
+
+	return size;
+}
+
+static uint32_t Pipe_Tick(void)
+{
+	return pipeNow;
+}
+
+static void Pipe_Sleep(uint32_t time)
+{
+}
+
+TP_Driver pipeDriver =
+{
+		.Open = Pipe_Open,
+		.Write = Pipe_Write,
+		.Read = Pipe_Read,
+		.Close = Pipe_Close,
+		.Flush = Pipe_Flush,
+		.Tick = Pipe_Tick,
+		.Sleep = Pipe_Sleep
+};
+
+static void LinkCallback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	Link *link = (Link *)param;
+
+	if(link->check != NULL && link->check(link, size, payload) == false)
+	{
+		link->errors++;
+	}
+
+	link->payloads[link->received % LINK_PAYLOADS] = payload;
+	link->size = size;
+	link->largest = (size > link->largest) ? size : link->largest;
+	link->received++;
+}
+
+void PipePairInit(PipePair *pair)
+{
+	memset(pair, 0, sizeof(PipePair));
+
+	pair->a.in = &pair->backward;
+	pair->a.out = &pair->forward;
+	pair->b.in = &pair->forward;
+	pair->b.out = &pair->backward;
+}
+
+bool LinkInit(Link *link, Port *port, ILinkCheck check)
+{
+	return LinkInitBuffer(link, port, check, link->buffer, sizeof(link->buffer));
+}
+
+bool LinkInitBuffer(Link *link, Port *port, ILinkCheck check, uint8_t *buffer, uint32_t size)
+{
+	memset(link, 0, sizeof(Link));
+	link->check = check;
+
+	return TP_Init(&link->obj, &pipeDriver, LinkCallback, link, port, LINK_TIMEOUT, buffer, size);
+}
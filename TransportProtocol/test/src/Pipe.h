@@ -0,0 +1,84 @@
+/*
+ * Pipe.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Douglas Reis
+ *
+ *  Memory pipes connecting two links in the same process, dropping and
+ *  corrupting writes on demand, and the links the tests run over them. The
+ *  clock only moves when the test moves it.
+ */
+
+#ifndef TEST_PIPE_H_
+#define TEST_PIPE_H_
+
+#include <stdint.h>
+#include <TransportProtocol.h>
+
+#define PIPE_SIZE		(256 * 1024)
+
+#define LINK_PAYLOAD_SIZE	1024
+#define LINK_PAYLOADS		64
+#define LINK_TIMEOUT		1000
+#define LINK_ARQ_SLOT_SIZE	(64 + 10)		/*!< Window slot of payloads up to 64 bytes */
+
+typedef struct
+{
+	uint8_t data[PIPE_SIZE];
+	uint32_t head;
+	uint32_t tail;
+	uint32_t writes;
+	uint32_t reads;
+	uint32_t dropEvery;				/*!< 0 never drops */
+	uint32_t corruptEvery;			/*!< 0 never corrupts */
+}Pipe;
+
+typedef struct
+{
+	Pipe *in;
+	Pipe *out;
+}Port;
+
+typedef struct
+{
+	Pipe forward;					/*!< Written by a */
+	Pipe backward;					/*!< Written by b */
+	Port a;
+	Port b;
+}PipePair;
+
+typedef struct Link Link;
+
+/* Tells whether a payload is the one the test expects, the link counts the others */
+typedef bool (*ILinkCheck)(Link *link, uint32_t size, const uint8_t *payload);
+
+/* One end of a pipe pair, recording the payloads its callback gets */
+struct Link
+{
+	TP_Obj obj;
+	uint8_t buffer[sizeof(TP_Context) + LINK_PAYLOAD_SIZE];
+	uint8_t txBuffer[LINK_PAYLOAD_SIZE];
+	uint8_t window[2 * TP_ARQ_WINDOW_MAX * LINK_ARQ_SLOT_SIZE];
+	uint8_t *payloads[LINK_PAYLOADS];	/*!< Payload i at i % LINK_PAYLOADS */
+	uint32_t received;
+	uint32_t size;						/*!< Size of the last payload */
+	uint32_t largest;
+	uint32_t errors;					/*!< Payloads rejected by check */
+	ILinkCheck check;					/*!< NULL takes any payload */
+};
+
+/* Opened with a Port, one write is one frame when the TX staging area is set */
+extern TP_Driver pipeDriver;
+
+extern uint32_t pipeNow;
+
+/* Empties both pipes, which neither drop nor corrupt, and connects the ports */
+void PipePairInit(PipePair *pair);
+
+/* TP_Init of a link over its own buffer, check may be NULL */
+bool LinkInit(Link *link, Port *port, ILinkCheck check);
+
+/* LinkInit with a larger RX buffer given by the test */
+bool LinkInitBuffer(Link *link, Port *port, ILinkCheck check, uint8_t *buffer, uint32_t size);
+
+#endif /* TEST_PIPE_H_ */
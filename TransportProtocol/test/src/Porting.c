@@ -26,6 +26,8 @@
 #include <errno.h>
 #include <sys/types.h>
 #include <sys/ioctl.h>
+#include <poll.h>
+#include <sys/uio.h>
 
 #include "circular_buffer.h"
 
@@ -101,15 +103,36 @@ void * UART_Open(const void *port)
 	return &op;
 }
 
-uint16_t UART_Write(void *handle, const void *buffer, uint16_t size)
+uint32_t UART_Write(void *handle, const void *buffer, uint32_t size)
 {
-	dumpBuffer((char*)buffer, size);
+//	dumpBuffer((char*)buffer, size);
 	size = sendto(op.connfd, (const char *)buffer, size, MSG_WAITALL , (const struct sockaddr *)&op.cli_addr, sizeof(op.cli_addr));
 
 	return size;
 }
 
-uint16_t UART_Read(void *handle, void *buffer, uint16_t size)
+uint32_t UART_WriteV(void *handle, const TP_IOVec *vector, uint8_t count)
+{
+	struct iovec iov[8];
+	struct msghdr message = { 0 };
+
+	count = (count > 8) ? 8 : count;
+	for(int i = 0; i < count; i++)
+	{
+		iov[i].iov_base = (void *)vector[i].buffer;
+		iov[i].iov_len = vector[i].size;
+//		dumpBuffer((char*)vector[i].buffer, vector[i].size);
+	}
+
+	message.msg_name = &op.cli_addr;
+	message.msg_namelen = sizeof(op.cli_addr);
+	message.msg_iov = iov;
+	message.msg_iovlen = count;
+
+	return sendmsg(op.connfd, &message, 0);
+}
+
+uint32_t UART_Read(void *handle, void *buffer, uint32_t size)
 {
 
 	char _buffer[1024];
@@ -135,6 +158,24 @@ uint16_t UART_Read(void *handle, void *buffer, uint16_t size)
 	return CircBufGet(&op.ringBuffer,buffer, size);
 }
 
+bool UART_Wait(void *handle, uint32_t deadline)
+{
+	struct pollfd fds = { .fd = op.connfd, .events = POLLIN };
+	int32_t remaining = (int32_t)(deadline - SYS_Tick());
+
+	if(CircBufFilledLenGet(&op.ringBuffer) > 0)
+	{
+		return true;
+	}
+
+	if(remaining <= 0)
+	{
+		return false;
+	}
+
+	return poll(&fds, 1, remaining) > 0;
+}
+
 uint16_t UART_Close(void *handle)
 {
 
@@ -15,11 +15,15 @@ extern "C" {
 #define __USE_MISC
 
 #include <stdint.h>
+#include <TransportProtocol.h>
+
 void * UART_Open(const void *port);
-uint16_t UART_Write(void *handle, const void *buffer, uint16_t size);
-uint16_t UART_Read(void *handle, void *buffer, uint16_t size);
+uint32_t UART_Write(void *handle, const void *buffer, uint32_t size);
+uint32_t UART_WriteV(void *handle, const TP_IOVec *vector, uint8_t count);
+uint32_t UART_Read(void *handle, void *buffer, uint32_t size);
 uint16_t UART_Close(void *handle);
 void     UART_Flush(void *handle);
+bool     UART_Wait(void *handle, uint32_t deadline);
 uint32_t SYS_Tick();
 void SYS_Sleep(uint32_t time);
 
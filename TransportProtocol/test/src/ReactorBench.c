@@ -0,0 +1,208 @@
+/*!
+ * @file ReactorBench.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  Frames per second parsed by one TP_Reactor thread as the amount of links grows.
+ *  Each link is one end of a socketpair, the other end is fed by this same thread.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <TransportProtocol.h>
+
+#define PAYLOAD_SIZE		64
+#define FRAMES_PER_ROUND	8
+#define FRAMES_PER_RUN		400000
+#define LINK_BUFFER_SIZE	(sizeof(TP_Context) + 256)
+
+typedef struct
+{
+	TP_Obj obj;
+	TP_ReactorLink link;
+	int fd;
+	int peer;
+	uint8_t buffer[LINK_BUFFER_SIZE];
+}BenchLink;
+
+static uint8_t frame[PAYLOAD_SIZE + 16];
+static uint32_t frameSize;
+static uint64_t received;
+
+static uint32_t SYS_Tick(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000 + ts.tv_nsec / (1000 * 1000);
+}
+
+static double SYS_Seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void SYS_Sleep(uint32_t time)
+{
+}
+
+static void *FD_Open(const void *port)
+{
+	return (void *)port;
+}
+
+static uint16_t FD_Close(void *handle)
+{
+	return 0;
+}
+
+static void FD_Flush(void *handle)
+{
+}
+
+static uint32_t FD_Read(void *handle, void *buffer, uint32_t size)
+{
+	ssize_t count = recv(*(int *)handle, buffer, size, MSG_DONTWAIT);
+	return (count > 0) ? count : 0;
+}
+
+static uint32_t FD_Write(void *handle, const void *buffer, uint32_t size)
+{
+	ssize_t count = send(*(int *)handle, buffer, size, MSG_DONTWAIT);
+	return (count >= 0) ? count : (uint32_t)-1;
+}
+
+/* Captures the frame built by TP_Send so the links can be fed with it */
+static uint32_t Capture_Write(void *handle, const void *buffer, uint32_t size)
+{
+	memcpy(&frame[frameSize], buffer, size);
+	frameSize += size;
+	return size;
+}
+
+static TP_Driver driver =
+{
+		.Open = FD_Open,
+		.Write = FD_Write,
+		.Read = FD_Read,
+		.Close = FD_Close,
+		.Flush = FD_Flush,
+		.Tick = SYS_Tick,
+		.Sleep = SYS_Sleep
+};
+
+static void Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	received++;
+}
+
+static bool BuildFrame(void)
+{
+	static uint8_t buffer[LINK_BUFFER_SIZE];
+	uint8_t payload[PAYLOAD_SIZE];
+	TP_Driver capture = driver;
+	TP_Obj obj;
+	int fd = -1;
+
+	capture.Write = Capture_Write;
+	for(uint32_t i = 0; i < sizeof(payload); i++)
+	{
+		payload[i] = (uint8_t)rand();
+	}
+
+	return TP_Init(&obj, &capture, NULL, NULL, &fd, 1000, buffer, sizeof(buffer)) &&
+			TP_Send(&obj, 1, payload, sizeof(payload));
+}
+
+static bool Run(uint32_t amount)
+{
+	BenchLink *links = calloc(amount, sizeof(BenchLink));
+	TP_Reactor reactor;
+	uint8_t burst[sizeof(frame) * FRAMES_PER_ROUND];
+	uint64_t expected = 0;
+	double elapsed = 0;
+	bool ret = links != NULL && TP_ReactorInit(&reactor, NULL, NULL);
+
+	for(uint32_t i = 0; i < FRAMES_PER_ROUND; i++)
+	{
+		memcpy(&burst[i * frameSize], frame, frameSize);
+	}
+
+	for(uint32_t i = 0; ret && i < amount; i++)
+	{
+		int fds[2];
+		ret = socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0;
+		if(ret)
+		{
+			links[i].fd = fds[0];
+			links[i].peer = fds[1];
+			ret = TP_Init(&links[i].obj, &driver, Callback, NULL, &links[i].fd, 1000, links[i].buffer, sizeof(links[i].buffer)) &&
+					TP_SetOptions(&links[i].obj, TP_OPTION_STREAMING) &&
+					TP_ReactorAdd(&reactor, &links[i].link, &links[i].obj, links[i].fd);
+		}
+	}
+
+	received = 0;
+	while(ret && expected < FRAMES_PER_RUN)
+	{
+		for(uint32_t i = 0; ret && i < amount; i++)
+		{
+			ret = write(links[i].peer, burst, frameSize * FRAMES_PER_ROUND) == frameSize * FRAMES_PER_ROUND;
+		}
+		expected += (uint64_t)amount * FRAMES_PER_ROUND;
+
+		double start = SYS_Seconds();
+		while(ret && received < expected)
+		{
+			ret = TP_ReactorRun(&reactor, 1000) > 0;
+		}
+		elapsed += SYS_Seconds() - start;
+	}
+
+	if(ret)
+	{
+		printf("%8u %12llu %14.0f\n", amount, (unsigned long long)received, received / elapsed);
+	}
+	else
+	{
+		printf("%8u failed after %llu frames\n", amount, (unsigned long long)received);
+	}
+
+	for(uint32_t i = 0; links != NULL && i < amount; i++)
+	{
+		if(links[i].peer > 0)
+		{
+			TP_ReactorRemove(&reactor, &links[i].link);
+			close(links[i].fd);
+			close(links[i].peer);
+		}
+	}
+	TP_ReactorClose(&reactor);
+	free(links);
+
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	const uint32_t amounts[] = { 1, 10, 100, 1000, 4000 };
+	bool ret = BuildFrame();
+
+	printf("   links       frames     frames/s\n");
+	for(uint32_t i = 0; ret && i < sizeof(amounts) / sizeof(amounts[0]); i++)
+	{
+		ret = Run(amounts[i]);
+	}
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,170 @@
+/*!
+ * @file ReactorTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  A reactor link fed through a socketpair with bursts of small frames, more
+ *  than its budget and its staging area hold, then hung up by the peer, once
+ *  after a burst and once in the middle of a frame.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include <TransportProtocol.h>
+
+#define FRAMES			40
+
+typedef struct
+{
+	TP_Obj obj;
+	TP_ReactorLink link;
+	int fd;
+	uint8_t buffer[sizeof(TP_Context) + 64];
+	uint32_t received;
+	bool ordered;
+	int hungUp;
+}Link;
+
+static uint32_t SYS_Tick(void)
+{
+	static uint32_t ticks;
+	return ticks++;
+}
+
+static void SYS_Sleep(uint32_t time)
+{
+}
+
+static void *FD_Open(const void *port)
+{
+	return (void *)port;
+}
+
+static uint16_t FD_Close(void *handle)
+{
+	return 0;
+}
+
+static void FD_Flush(void *handle)
+{
+}
+
+static uint32_t FD_Read(void *handle, void *buffer, uint32_t size)
+{
+	ssize_t count = recv(*(int *)handle, buffer, size, MSG_DONTWAIT);
+	return (count > 0) ? count : 0;
+}
+
+static uint32_t FD_Write(void *handle, const void *buffer, uint32_t size)
+{
+	ssize_t count = send(*(int *)handle, buffer, size, MSG_DONTWAIT);
+	return (count >= 0) ? count : (uint32_t)-1;
+}
+
+static TP_Driver driver =
+{
+		.Open = FD_Open,
+		.Write = FD_Write,
+		.Read = FD_Read,
+		.Close = FD_Close,
+		.Flush = FD_Flush,
+		.Tick = SYS_Tick,
+		.Sleep = SYS_Sleep
+};
+
+static void Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
+{
+	Link *link = (Link *)param;
+
+	link->ordered &= (size == 2 && payload[0] == (uint8_t)link->received);
+	link->received++;
+}
+
+static void Hangup(void *param, TP_Obj *obj, int fd)
+{
+	Link *link = (Link *)param;
+
+	link->hungUp += (obj == &link->obj && fd == link->fd);
+}
+
+static bool Burst(Link *peer)
+{
+	bool ret = true;
+
+	/* 9 bytes frames, which don't line up with the staging area */
+	for(uint8_t i = 0; ret && i < FRAMES; i++)
+	{
+		uint8_t payload[2] = { i, i };
+		ret = TP_Send(&peer->obj, 1, payload, sizeof(payload));
+	}
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	static Link link, peer;
+	TP_Reactor reactor;
+	int fds[2];
+	bool ret = socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0;
+
+	link.fd = fds[0];
+	link.ordered = true;
+	peer.fd = fds[1];
+
+	ret = ret && TP_ReactorInit(&reactor, Hangup, &link) &&
+			TP_Init(&link.obj, &driver, Callback, &link, &link.fd, 1000, link.buffer, sizeof(link.buffer)) &&
+			TP_Init(&peer.obj, &driver, Callback, &peer, &peer.fd, 1000, peer.buffer, sizeof(peer.buffer)) &&
+			TP_ReactorAdd(&reactor, &link.link, &link.obj, link.fd);
+
+	/* Frames staged after the fd is drained are parsed without a new event */
+	ret = ret && Burst(&peer);
+	for(uint32_t run = 0; ret && run < 10 && link.received < FRAMES; run++)
+	{
+		ret = TP_ReactorRun(&reactor, 0) >= 0;
+	}
+	ret = ret && link.received == FRAMES && link.ordered && reactor.ready == NULL;
+
+	printf("Reactor     : %s\n", ret ? "Aproved!" : "failed");
+
+	/* Bytes sent before the hang up are parsed, then the link leaves the reactor */
+	link.received = 0;
+	ret = ret && Burst(&peer) && close(peer.fd) == 0;
+	for(uint32_t run = 0; ret && run < 10 && link.hungUp == 0; run++)
+	{
+		ret = TP_ReactorRun(&reactor, 100) >= 0;
+	}
+	ret = ret && link.received == FRAMES && link.ordered && link.hungUp == 1 && reactor.links == 0;
+	ret = ret && TP_ReactorRun(&reactor, 0) == 0;
+
+	printf("Reactor hup : %s\n", ret ? "Aproved!" : "failed");
+
+	/* Streaming doesn't lift the budget, and a trailing STX byte which can't complete is dropped with the link */
+	close(link.fd);
+	ret = ret && socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0;
+	link.fd = fds[0];
+	link.received = 0;
+	link.hungUp = 0;
+	peer.fd = fds[1];
+	ret = ret && TP_SetOptions(&link.obj, TP_OPTION_STREAMING) && TP_Flush(&link.obj) &&
+			TP_ReactorAdd(&reactor, &link.link, &link.obj, link.fd);
+	ret = ret && Burst(&peer) && send(peer.fd, "\x5A", 1, 0) == 1;
+	ret = ret && TP_ReactorRun(&reactor, 100) == 1 && link.received == TP_REACTOR_BUDGET;
+	ret = ret && close(peer.fd) == 0;
+	for(uint32_t run = 0; ret && run < 10 && link.hungUp == 0; run++)
+	{
+		ret = TP_ReactorRun(&reactor, 100) >= 0;
+	}
+	ret = ret && link.received == FRAMES && link.ordered && link.hungUp == 1 && reactor.links == 0 && reactor.ready == NULL;
+
+	printf("Reactor tail: %s\n", ret ? "Aproved!" : "failed");
+
+	TP_ReactorClose(&reactor);
+	close(link.fd);
+
+	return ret ? 0 : 1;
+}
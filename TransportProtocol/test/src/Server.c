@@ -17,6 +17,7 @@ typedef struct
 	uint8_t payload[1024];
 	uint32_t size;
 	uint32_t timeout;
+	uint8_t *slot;
 }ClassServerTest;
 
 TP_Driver driver =
@@ -27,21 +28,24 @@ TP_Driver driver =
 		.Close = UART_Close,
 		.Flush = UART_Flush,
 		.Tick = SYS_Tick,
-		.Sleep = SYS_Sleep
+		.Sleep = SYS_Sleep,
+		.Wait = UART_Wait
 };
 
-void Callback(void *param, uint8_t address, uint16_t size, uint8_t *payload)
+void Callback(void *param, uint8_t address, uint32_t size, uint8_t *payload)
 {
 	ClassServerTest *test = (ClassServerTest*) param;
 	test->running = false;
 	memcpy(test->payload, payload, size);
 	test->size = size;
+	test->slot = payload;
 }
 
 int main (int argc, char** argv)
 {
 
 	uint8_t buffer[1024];
+	uint8_t txBuffer[1024];
 	ClassServerTest test =
 	{
 			.running = true,
@@ -54,6 +58,21 @@ int main (int argc, char** argv)
 	bool ret = TP_Init(&test.obj, &driver, Callback, &test, "server:8888", 1000, buffer, sizeof(buffer));
 	test.timeout = SYS_Tick() + TIMEOUT;
 
+	if(ret)
+	{
+		ret = TP_SetTxBuffer(&test.obj, txBuffer, sizeof(txBuffer));
+	}
+
+	if(ret)
+	{
+		ret = TP_SetOptions(&test.obj, TP_OPTION_STREAMING);
+	}
+
+	if(ret)
+	{
+		ret = TP_SetRxSlots(&test.obj, 2);
+	}
+
 	while(ret)
 	{
 		test.running = true;
@@ -68,6 +87,7 @@ int main (int argc, char** argv)
 
 		printf("\nReplying %s\n", test.payload);
 		TP_Send(&test.obj, 0, test.payload, test.size);
+		TP_Release(&test.obj, test.slot);
 		test.timeout = SYS_Tick() + TIMEOUT;
 	}
 
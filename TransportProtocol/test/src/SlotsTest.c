@@ -0,0 +1,82 @@
+/*!
+ * @file SlotsTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  A server holding every RX slot: the frames behind stay in the driver and
+ *  are delivered in order as the slots are released.
+ */
+
+#include <stdlib.h>
+
+#include <TransportProtocol.h>
+#include "Pipe.h"
+
+#define FRAMES			20
+#define SLOTS			3
+#define PAYLOAD_SIZE	20
+
+static uint8_t blob[PAYLOAD_SIZE];
+
+/* The first byte of frame i is i, so a frame out of order is an error */
+static bool Check(Link *link, uint32_t size, const uint8_t *payload)
+{
+	return size == PAYLOAD_SIZE && payload[0] == link->received && memcmp(&payload[1], &blob[1], size - 1) == 0;
+}
+
+static bool TestOwned(void)
+{
+	static PipePair pipes;
+	static Link a, b;
+
+	PipePairInit(&pipes);
+	bool ret = LinkInit(&a, &pipes.a, NULL) && LinkInit(&b, &pipes.b, Check) &&
+			TP_SetOptions(&b.obj, TP_OPTION_STREAMING) && TP_SetRxSlots(&b.obj, SLOTS);
+
+	for(uint32_t i = 0; ret && i < FRAMES; i++)
+	{
+		blob[0] = (uint8_t)i;
+		ret = TP_Send(&a.obj, 1, blob, PAYLOAD_SIZE);
+	}
+
+	/* Every slot is owned, the parser stops and the rest of the stream stays in the driver */
+	for(uint32_t i = 0; i < 10; i++)
+	{
+		TP_Poll(&b.obj);
+	}
+	ret = ret && b.received == SLOTS && pipes.forward.tail != pipes.forward.head;
+
+	/* One slot released lets exactly one queued frame in */
+	ret = ret && TP_Release(&b.obj, b.payloads[0]);
+	TP_Poll(&b.obj);
+	TP_Poll(&b.obj);
+	ret = ret && b.received == SLOTS + 1;
+
+	/* The rest follows in order, one frame per release */
+	for(uint32_t i = 1; ret && i < FRAMES - SLOTS; i++)
+	{
+		ret = TP_Release(&b.obj, b.payloads[i]);
+		TP_Poll(&b.obj);
+		ret = ret && b.received == SLOTS + 1 + i;
+	}
+
+	ret = ret && b.received == FRAMES && b.errors == 0 && pipes.forward.tail == pipes.forward.head;
+
+	printf("Slots owned : %s\n", ret ? "Aproved!" : "failed");
+	return ret;
+}
+
+int main(int argc, char** argv)
+{
+	bool ret = true;
+
+	for(uint32_t i = 0; i < sizeof(blob); i++)
+	{
+		blob[i] = (uint8_t)rand();
+	}
+
+	ret &= TestOwned();
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,78 @@
+/*!
+ * @file TraceTest.c
+ *
+ *  @date Oct 18, 2026
+ *  @author Douglas Reis
+ *
+ *  State transitions recorded in the trace ring while frames are received,
+ *  optionally written to a file for tools/TraceDump.py.
+ */
+
+#include <stdio.h>
+
+#include <TransportProtocol.h>
+#include <Trace.h>
+#include "Pipe.h"
+
+#define RECORDS			16
+
+static uint8_t payload[256];
+static TPTraceRecord ring[RECORDS];
+
+int main(int argc, char** argv)
+{
+	static PipePair pipes;
+	static Link a, b;
+	static const uint8_t expected[][2] =
+	{
+			{ TP_TRACE_IDLE, TP_TRACE_STARTING_FRAME },
+			{ TP_TRACE_STARTING_FRAME, TP_TRACE_PAYLOAD },
+			{ TP_TRACE_PAYLOAD, TP_TRACE_CHECKSUM },
+			{ TP_TRACE_CHECKSUM, TP_TRACE_NONE },
+			{ TP_TRACE_IDLE, TP_TRACE_IDLE }
+	};
+	TPTraceRecord records[2 * RECORDS];
+	uint32_t count = 0;
+
+	PipePairInit(&pipes);
+	bool ret = LinkInit(&a, &pipes.a, NULL) && LinkInit(&b, &pipes.b, NULL);
+
+	ret = ret && TP_SetTrace(&b.obj, ring, 10) == false && TP_SetTrace(&b.obj, ring, RECORDS);
+
+	/* A frame and a poll with nothing to read */
+	ret = ret && TP_Send(&a.obj, 1, payload, 100);
+	pipeNow = 7;
+	ret = ret && TP_Poll(&b.obj) == TPSuccess && TP_Poll(&b.obj) == TPIsRunning;
+
+	count = TP_GetTrace(&b.obj, records, 2 * RECORDS);
+	ret = ret && count == sizeof(expected) / sizeof(expected[0]);
+	for(uint32_t i = 0; ret && i < count; i++)
+	{
+		ret = records[i].from == expected[i][0] && records[i].to == expected[i][1] && records[i].tick == 7;
+	}
+	ret = ret && records[3].bytesRead == 5 + 100 + 2 && records[3].status == TPSuccess;
+
+	/* Only the newest records are kept, but the oldest, which the parser could be overwriting */
+	for(uint32_t i = 0; ret && i < 10; i++)
+	{
+		ret = TP_Send(&a.obj, 1, payload, i);
+		pipeNow++;
+		TP_Poll(&b.obj);
+	}
+	count = TP_GetTrace(&b.obj, records, 2 * RECORDS);
+	ret = ret && count == RECORDS - 1 && records[RECORDS - 2].tick == 17 && records[0].tick < records[RECORDS - 2].tick;
+
+	if(ret && argc > 1)
+	{
+		FILE *file = fopen(argv[1], "wb");
+		ret = file != NULL && fwrite(records, sizeof(TPTraceRecord), count, file) == count;
+		if(file != NULL)
+		{
+			fclose(file);
+		}
+	}
+
+	printf("Trace       : %s\n", ret ? "Aproved!" : "failed");
+
+	return ret ? 0 : 1;
+}
@@ -0,0 +1,59 @@
+# Compares two reports of make bench, e.g. before and after an optimization:
+#
+#   python3 tools/BenchCompare.py before.json after.json [--threshold 10]
+#
+# Each result found in both reports is shown with its change, positive when it
+# got better; MB/s is better higher, the ns units are better lower. The exit
+# status is 1 when any result got worse than the threshold, in percent.
+
+import argparse
+import json
+import sys
+
+
+def Load(path):
+    with open(path) as file:
+        report = json.load(file)
+
+    return report, {(r["name"], r["size"]): r for r in report["results"]}
+
+
+def Change(old, new):
+    if old["value"] == 0 or new["value"] == 0:
+        return 0.0
+
+    if old["unit"].startswith("ns/"):
+        return (old["value"] / new["value"] - 1) * 100
+    return (new["value"] / old["value"] - 1) * 100
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compares two make bench reports")
+    parser.add_argument("before", help="report of the reference commit")
+    parser.add_argument("after", help="report of the commit measured")
+    parser.add_argument("--threshold", type=float, default=10.0, help="regression tolerated, in percent")
+    args = parser.parse_args()
+
+    before, old = Load(args.before)
+    after, new = Load(args.after)
+    regressions = 0
+
+    print("{} {} -> {}".format(after["project"], before["commit"] or "?", after["commit"] or "?"))
+    for key, result in new.items():
+        if key not in old:
+            continue
+
+        change = Change(old[key], result)
+        mark = ""
+        if change < -args.threshold:
+            mark = "  REGRESSION"
+            regressions += 1
+
+        print("{:<28} {:>7} {:>14.3f} {:>14.3f} {:<13} {:>+8.1f}%{}".format(
+            key[0], key[1], old[key]["value"], result["value"], result["unit"], change, mark))
+
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
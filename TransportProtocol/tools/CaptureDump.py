@@ -0,0 +1,231 @@
+# Decodes the frames captured to pcapng by tools/Pcapng.c:
+#
+#   python3 tools/CaptureDump.py capture.pcapng [--layer tp|ldp|dvp] [--arq] [--hex]
+#
+# Each line shows the capture time, the direction, the address, the verdict of
+# the frame and its TransportProtocol header. With --layer the payload is also
+# decoded as a LDP_Frame or DVP_Frame, type, id and status code; with --arq the
+# reliable mode header of TP_SetArq is taken out of the payload first.
+
+import argparse
+import struct
+import sys
+
+SHB = 0x0A0D0D0A
+IDB = 0x00000001
+EPB = 0x00000006
+MAGIC = 0x1A2B3C4D
+
+# TP_PCAPNG_LINKTYPE of Pcapng.h, LINKTYPE_USER0
+LINKTYPE = 147
+
+# TP_CAPTURE_* of Context.h
+DIRECTIONS = {0: "RX", 1: "TX"}
+
+# TPStatus of Status.h
+STATUS = [
+    "TPNone",
+    "TPFailure",
+    "TPSuccess",
+    "TPInactivity",
+    "TPIsRunning",
+    "TPCommandIDUnknown",
+    "TPCommandNotImplemented",
+    "TPErrorChecksum",
+    "TPErrorSending",
+    "TPTimeout",
+    "TPFrameError",
+    "TPBufferOverflow",
+]
+
+# TP_STX and TP_STX_JUMBO of Frame.h
+STX = 0x5A55
+STX_JUMBO = 0x5A56
+
+# TP_ARQ_* of Arq.h
+ARQ = {1: "DATA", 2: "ACK", 3: "NAK"}
+
+# LDP_PacketType and DVP_PacketType of Frame.h
+TYPES = {0: "Command", 1: "Response", 2: "Event"}
+
+# LDP_FrameID and LDP_StatusCode of LDP/src
+LDP_IDS = {0xC0: "Cmd1", 0xC1: "Cmd2", 0xE0: "Evt1", 0xE1: "Evt2"}
+LDP_STATUS = {
+    0x00: "OK",
+    0x01: "NotAvailableError",
+    0x02: "TimeoutError",
+    0x03: "ProtocolError",
+    0x04: "NotOpenError",
+    0x05: "ParameterError",
+    0xFE: "NotSupportedError",
+    0xFF: "GeneralError",
+}
+
+# DVP_FrameID and DVP_StatusCode of DVP/src
+DVP_IDS = {
+    0xC0: "ReadVehicleStatus",
+    0xC1: "WriteVehicleStatus",
+    0xC2: "ReadVehicleConfig",
+    0xC3: "WriteVehicleConfig",
+    0xC4: "ReadVehicleInfo",
+    0xC5: "ReadBatteryStatus",
+    0xC6: "ReadBatteryInfo",
+    0xCA: "FirmwareUpdateStart",
+    0xCB: "FirmwareUpdateLoad",
+    0xCC: "FirmwareUpdateFinish",
+    0xA0: "StartAuthentication",
+    0xA1: "Authenticate",
+    0xA2: "UpdatePublicKey",
+    0xE0: "KeepAlive",
+}
+DVP_STATUS = {
+    0x00: "OK",
+    0x01: "TimeoutError",
+    0x02: "ProtocolError",
+    0x03: "NotOpenError",
+    0x04: "ParameterError",
+    0x05: "Unauthenticated",
+    0x06: "CRCError",
+    0x07: "NotSupportedError",
+    0xFF: "GeneralError",
+}
+
+LAYERS = {
+    "ldp": ("LDP", LDP_IDS, LDP_STATUS),
+    "dvp": ("DVP", DVP_IDS, DVP_STATUS),
+}
+
+# Pseudo header of Pcapng.h: direction, address, status, reserved, tick
+PSEUDO_HEADER = struct.Struct("<BBbBI")
+
+
+def Blocks(data):
+    order = "<"
+    offset = 0
+
+    while offset + 12 <= len(data):
+        if struct.unpack_from("<I", data, offset)[0] == SHB:
+            order = "<" if struct.unpack_from("<I", data, offset + 8)[0] == MAGIC else ">"
+
+        kind, length = struct.unpack_from(order + "II", data, offset)
+        if length < 12 or offset + length > len(data):
+            break
+
+        yield order, kind, data[offset + 8:offset + length - 4]
+        offset += length
+
+
+def Packets(data):
+    links = []
+
+    for order, kind, body in Blocks(data):
+        if kind == SHB:
+            links = []
+        elif kind == IDB:
+            links.append(struct.unpack_from(order + "H", body)[0])
+        elif kind == EPB:
+            interface, high, low, captured, _ = struct.unpack_from(order + "IIIII", body)
+            if interface < len(links) and links[interface] == LINKTYPE:
+                yield (high << 32) | low, body[20:20 + captured]
+
+
+def DecodeTP(frame):
+    """Header fields and payload of a frame, None when it isn't one"""
+    if len(frame) < 5:
+        return None
+
+    stx, address = struct.unpack_from(">HB", frame)
+    if stx == STX:
+        size, headerSize = struct.unpack_from(">H", frame, 3)[0], 5
+    elif stx == STX_JUMBO and len(frame) >= 7:
+        size, headerSize = struct.unpack_from(">I", frame, 3)[0], 7
+    else:
+        return None
+
+    # TP_OPTION_HEADER_CHECK moves the payload one byte
+    check = len(frame) == headerSize + 1 + size + 2
+    if check:
+        headerSize += 1
+
+    payload = frame[headerSize:headerSize + size]
+    crc = struct.unpack_from("<H", frame, len(frame) - 2)[0]
+    return address, "jumbo" if stx == STX_JUMBO else "std", check, payload, crc
+
+
+def DecodeARQ(payload):
+    if len(payload) < 2:
+        return "ARQ ?", b""
+
+    kind, sequence = payload[0], payload[1]
+    if kind == 1:
+        return "ARQ {} seq={}".format(ARQ[kind], sequence), payload[2:]
+    return "ARQ {} next={}".format(ARQ.get(kind, kind), sequence), None
+
+
+def DecodeLayer(layer, payload):
+    name, ids, codes = LAYERS[layer]
+
+    if len(payload) < 3:
+        return "{} ?".format(name)
+
+    kind, ident, code = payload[0], payload[1], payload[2]
+    return "{} {} {} {} [{}]".format(
+        name,
+        TYPES.get(kind, kind),
+        ids.get(ident, "0x{:02X}".format(ident)),
+        codes.get(code, "0x{:02X}".format(code)),
+        len(payload) - 3,
+    )
+
+
+def Dump(data, layer, arq, hexdump, out):
+    start = None
+
+    for timestamp, packet in Packets(data):
+        if len(packet) < PSEUDO_HEADER.size:
+            continue
+
+        direction, address, status, _, tick = PSEUDO_HEADER.unpack_from(packet)
+        frame = packet[PSEUDO_HEADER.size:]
+        start = timestamp if start is None else start
+
+        name = STATUS[status + 1] if -1 <= status < len(STATUS) - 1 else str(status)
+        line = "{:>14.6f} {:>10} {} addr={:<3} {:<16}".format(
+            (timestamp - start) / 1e9, tick, DIRECTIONS.get(direction, direction), address, name)
+
+        decoded = DecodeTP(frame)
+        if decoded is None:
+            line += " not a frame, {} bytes".format(len(frame))
+        else:
+            _, kind, check, payload, crc = decoded
+            line += " TP {}{} size={} crc=0x{:04X}".format(kind, "+check" if check else "", len(payload), crc)
+
+            if arq:
+                text, payload = DecodeARQ(payload)
+                line += " | " + text
+
+            if layer in LAYERS and payload is not None:
+                line += " | " + DecodeLayer(layer, payload)
+
+            if hexdump and payload:
+                line += "\n    " + payload.hex(" ")
+
+        out.write(line + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes a TransportProtocol pcapng capture")
+    parser.add_argument("file", help="capture written by tools/Pcapng.c")
+    parser.add_argument("--layer", choices=["tp", "ldp", "dvp"], default="tp", help="protocol carried in the payload")
+    parser.add_argument("--arq", action="store_true", help="frames of a link with TP_SetArq")
+    parser.add_argument("--hex", action="store_true", help="also print the payloads")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as file:
+        data = file.read()
+
+    Dump(data, args.layer, args.arq, args.hex, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,284 @@
+/**
+ * @file    Pcapng.c
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <time.h>
+
+#include "Pcapng.h"
+
+#define TP_PCAPNG_SHB			0x0A0D0D0A	/*!< Section header block */
+#define TP_PCAPNG_IDB			0x00000001	/*!< Interface description block */
+#define TP_PCAPNG_EPB			0x00000006	/*!< Enhanced packet block */
+#define TP_PCAPNG_MAGIC			0x1A2B3C4D
+
+#define TP_PCAPNG_OPT_END		0
+#define TP_PCAPNG_IF_NAME		2
+#define TP_PCAPNG_IF_TSRESOL	9
+#define TP_PCAPNG_EPB_FLAGS		2
+#define TP_PCAPNG_INBOUND		0x1
+#define TP_PCAPNG_OUTBOUND		0x2
+
+/* Type, length, interface, timestamp and lengths, epb_flags, end of options and length */
+#define TP_PCAPNG_EPB_OVERHEAD	(7 * 4 + 8 + 4 + 4)
+
+#define TPPcapngPad(size)		(((size) + 3) & ~3u)
+
+static uint8_t *TPPcapngPut(uint8_t *buffer, const void *data, uint32_t size)
+{
+	memcpy(buffer, data, size);
+	return buffer + size;
+}
+
+static uint8_t *TPPcapngPut32(uint8_t *buffer, uint32_t value)
+{
+	return TPPcapngPut(buffer, &value, sizeof(value));
+}
+
+static uint8_t *TPPcapngPutOption(uint8_t *buffer, uint16_t code, const void *data, uint16_t size)
+{
+	uint16_t option[] = { code, size };
+
+	buffer = TPPcapngPut(buffer, option, sizeof(option));
+	if(size > 0)
+	{
+		buffer = TPPcapngPut(buffer, data, size);
+	}
+	memset(buffer, 0, TPPcapngPad(size) - size);
+
+	return buffer + TPPcapngPad(size) - size;
+}
+
+/* Closes a block started at start, whose length field follows its type */
+static uint8_t *TPPcapngEndBlock(uint8_t *start, uint8_t *buffer)
+{
+	uint32_t length = (uint32_t)(buffer - start) + 4;
+
+	memcpy(&start[4], &length, sizeof(length));
+	return TPPcapngPut32(buffer, length);
+}
+
+static bool TPPcapngWriteHeader(TPPcapng *pcap)
+{
+	static const char name[] = "TransportProtocol";
+	static const uint8_t nanoseconds = 9;
+	static const uint16_t version[] = { 1, 0 };
+	const int64_t sectionLength = -1;
+	const uint16_t link[] = { TP_PCAPNG_LINKTYPE, 0 };
+	uint8_t header[128];
+	uint8_t *buffer = header;
+	uint8_t *block = buffer;
+
+	buffer = TPPcapngPut32(buffer, TP_PCAPNG_SHB);
+	buffer = TPPcapngPut32(buffer, 0);
+	buffer = TPPcapngPut32(buffer, TP_PCAPNG_MAGIC);
+	buffer = TPPcapngPut(buffer, version, sizeof(version));
+	buffer = TPPcapngPut(buffer, &sectionLength, sizeof(sectionLength));
+	buffer = TPPcapngEndBlock(block, buffer);
+
+	block = buffer;
+	buffer = TPPcapngPut32(buffer, TP_PCAPNG_IDB);
+	buffer = TPPcapngPut32(buffer, 0);
+	buffer = TPPcapngPut(buffer, link, sizeof(link));
+	buffer = TPPcapngPut32(buffer, 0);
+	buffer = TPPcapngPutOption(buffer, TP_PCAPNG_IF_NAME, name, sizeof(name) - 1);
+	buffer = TPPcapngPutOption(buffer, TP_PCAPNG_IF_TSRESOL, &nanoseconds, sizeof(nanoseconds));
+	buffer = TPPcapngPutOption(buffer, TP_PCAPNG_OPT_END, NULL, 0);
+	buffer = TPPcapngEndBlock(block, buffer);
+
+	return fwrite(header, 1, buffer - header, pcap->file) == (size_t)(buffer - header);
+}
+
+/* Writes the half waiting for it, or the one being filled when there is none; called locked */
+static bool TPPcapngWriteHalf(TPPcapng *pcap)
+{
+	uint8_t half = pcap->filling ^ 1;
+	bool ret = true;
+
+	if(pcap->length[half] == 0)
+	{
+		if(pcap->length[pcap->filling] == 0)
+		{
+			return true;
+		}
+
+		half = pcap->filling;
+		pcap->filling ^= 1;
+	}
+
+	pthread_mutex_unlock(&pcap->lock);
+	ret = fwrite(pcap->halves[half], 1, pcap->length[half], pcap->file) == pcap->length[half];
+	fflush(pcap->file);
+	pthread_mutex_lock(&pcap->lock);
+
+	pcap->length[half] = 0;
+	return ret;
+}
+
+static void *TPPcapngThread(void *param)
+{
+	TPPcapng *pcap = (TPPcapng *)param;
+
+	pthread_mutex_lock(&pcap->lock);
+	while(pcap->running)
+	{
+		if(pcap->length[pcap->filling ^ 1] == 0)
+		{
+			struct timespec deadline;
+
+			clock_gettime(CLOCK_REALTIME, &deadline);
+			deadline.tv_nsec += TP_PCAPNG_FLUSH_PERIOD * 1000000L;
+			deadline.tv_sec += deadline.tv_nsec / 1000000000L;
+			deadline.tv_nsec %= 1000000000L;
+
+			pthread_cond_timedwait(&pcap->wake, &pcap->lock, &deadline);
+		}
+
+		TPPcapngWriteHalf(pcap);
+	}
+	pthread_mutex_unlock(&pcap->lock);
+
+	return NULL;
+}
+
+bool TPPcapngOpen(TPPcapng *pcap, const char *path, uint8_t *buffer, uint32_t size)
+{
+	memset(pcap, 0, sizeof(TPPcapng));
+
+	pcap->file = fopen(path, "wb");
+	if(pcap->file == NULL || TPPcapngWriteHeader(pcap) == false)
+	{
+		goto end;
+	}
+
+	pcap->size = size / 2;
+	pcap->halves[0] = buffer;
+	pcap->halves[1] = buffer + pcap->size;
+	pcap->running = true;
+
+	pthread_mutex_init(&pcap->lock, NULL);
+	pthread_cond_init(&pcap->wake, NULL);
+	if(pthread_create(&pcap->thread, NULL, TPPcapngThread, pcap) != 0)
+	{
+		pthread_cond_destroy(&pcap->wake);
+		pthread_mutex_destroy(&pcap->lock);
+		goto end;
+	}
+
+	return true;
+
+	end:
+	if(pcap->file != NULL)
+	{
+		fclose(pcap->file);
+		pcap->file = NULL;
+	}
+	return false;
+}
+
+void TPPcapngCapture(void *param, const TPCaptureInfo *info, const TP_IOVec *parts, uint8_t count)
+{
+	TPPcapng *pcap = (TPPcapng *)param;
+	uint8_t pseudo[TP_PCAPNG_PSEUDO_HEADER_SIZE] =
+	{
+			info->direction, info->address, (uint8_t)info->status, 0,
+			info->tick & 0xFF, (info->tick >> 8) & 0xFF, (info->tick >> 16) & 0xFF, (info->tick >> 24) & 0xFF
+	};
+	uint32_t flags = (info->direction == TP_CAPTURE_RX) ? TP_PCAPNG_INBOUND : TP_PCAPNG_OUTBOUND;
+	uint32_t length = sizeof(pseudo);
+	struct timespec now;
+	uint64_t timestamp = 0;
+	uint8_t *buffer = NULL;
+	uint8_t *block = NULL;
+
+	for(uint8_t i = 0; i < count; i++)
+	{
+		length += parts[i].size;
+	}
+
+	clock_gettime(CLOCK_REALTIME, &now);
+	timestamp = (uint64_t)now.tv_sec * 1000000000u + now.tv_nsec;
+
+	pthread_mutex_lock(&pcap->lock);
+
+	/* The full half goes to the thread as soon as it wrote the other one */
+	if(pcap->length[pcap->filling] + TP_PCAPNG_EPB_OVERHEAD + TPPcapngPad(length) > pcap->size &&
+	   pcap->length[pcap->filling ^ 1] == 0)
+	{
+		pcap->filling ^= 1;
+		pthread_cond_signal(&pcap->wake);
+	}
+
+	if(pcap->length[pcap->filling] + TP_PCAPNG_EPB_OVERHEAD + TPPcapngPad(length) > pcap->size)
+	{
+		pcap->dropped++;
+		pthread_mutex_unlock(&pcap->lock);
+		return;
+	}
+
+	block = buffer = pcap->halves[pcap->filling] + pcap->length[pcap->filling];
+	buffer = TPPcapngPut32(buffer, TP_PCAPNG_EPB);
+	buffer = TPPcapngPut32(buffer, 0);
+	buffer = TPPcapngPut32(buffer, 0);
+	buffer = TPPcapngPut32(buffer, (uint32_t)(timestamp >> 32));
+	buffer = TPPcapngPut32(buffer, (uint32_t)timestamp);
+	buffer = TPPcapngPut32(buffer, length);
+	buffer = TPPcapngPut32(buffer, length);
+
+	buffer = TPPcapngPut(buffer, pseudo, sizeof(pseudo));
+	for(uint8_t i = 0; i < count; i++)
+	{
+		buffer = TPPcapngPut(buffer, parts[i].buffer, parts[i].size);
+	}
+	memset(buffer, 0, TPPcapngPad(length) - length);
+	buffer += TPPcapngPad(length) - length;
+
+	buffer = TPPcapngPutOption(buffer, TP_PCAPNG_EPB_FLAGS, &flags, sizeof(flags));
+	buffer = TPPcapngPutOption(buffer, TP_PCAPNG_OPT_END, NULL, 0);
+	buffer = TPPcapngEndBlock(block, buffer);
+
+	pcap->length[pcap->filling] += (uint32_t)(buffer - block);
+	pcap->captured++;
+
+	pthread_mutex_unlock(&pcap->lock);
+}
+
+bool TPPcapngClose(TPPcapng *pcap)
+{
+	bool ret = true;
+
+	TP_ASSERT(pcap->file == NULL);
+
+	pthread_mutex_lock(&pcap->lock);
+	pcap->running = false;
+	pthread_cond_signal(&pcap->wake);
+	pthread_mutex_unlock(&pcap->lock);
+	pthread_join(pcap->thread, NULL);
+
+	/* The half left by the thread, then the one being filled */
+	pthread_mutex_lock(&pcap->lock);
+	ret = TPPcapngWriteHalf(pcap) && TPPcapngWriteHalf(pcap);
+	pthread_mutex_unlock(&pcap->lock);
+
+	pthread_cond_destroy(&pcap->wake);
+	pthread_mutex_destroy(&pcap->lock);
+
+	ret = (fclose(pcap->file) == 0) && ret;
+	pcap->file = NULL;
+
+	return ret;
+
+	end:
+	return false;
+}
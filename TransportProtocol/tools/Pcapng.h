@@ -0,0 +1,83 @@
+/**
+ * @file    Pcapng.h
+ * @author  Douglas Reis
+ * @date    18/10/2026
+ * @version 1.0
+ *
+ * @section LICENSE
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Host only pcapng writer for TP_SetCapture. Each frame becomes an enhanced
+ * packet block of link type LINKTYPE_USER0, the whole frame on the wire preceded
+ * by the pseudo header below, with the direction also in its epb_flags.
+ *
+ * | Field         | Size | Offset | Description                                 |
+ * |:--:           |:--:  |:--:    |:--                                          |
+ * |**Direction**  |1     |0       |TP_CAPTURE_RX or TP_CAPTURE_TX.              |
+ * |**Address**    |1     |1       |Address of the frame.                        |
+ * |**Status**     |1     |2       |TPStatus verdict, signed.                    |
+ * |**Reserved**   |1     |3       |0.                                           |
+ * |**Tick**       |4     |4       |TP_Driver::Tick, little endian.              |
+ *
+ * The capture callback only copies the block into one half of the buffer given
+ * to TPPcapngOpen; a thread writes the other half to the file, so the link never
+ * waits for the disk. Frames are dropped and counted when both halves are full.
+ * tools/CaptureDump.py decodes the file, Wireshark opens it too.
+ */
+
+#ifndef TPPCAPNG_H_
+#define TPPCAPNG_H_
+
+#include <stdio.h>
+#include <pthread.h>
+
+#include <TransportProtocol.h>
+
+#define TP_PCAPNG_LINKTYPE			147		/*!< LINKTYPE_USER0 */
+#define TP_PCAPNG_PSEUDO_HEADER_SIZE	8
+#define TP_PCAPNG_FLUSH_PERIOD		100		/*!< Milliseconds a partial half waits to be written */
+
+typedef struct TPPcapng
+{
+	FILE *file;
+	uint8_t *halves[2];						/*!< Halves of the buffer given to TPPcapngOpen */
+	uint32_t size;							/*!< Size of each half */
+	uint32_t length[2];						/*!< Bytes of each half not written yet */
+	uint8_t filling;						/*!< Half the capture callback appends to */
+	bool running;
+	uint64_t captured;						/*!< Frames copied to the buffer */
+	uint32_t dropped;						/*!< Frames lost because both halves were full */
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+	pthread_t thread;
+} TPPcapng;
+
+/*!
+ * Creates the file with its section and interface blocks and starts the writer thread.
+ *
+ * @param pcap   Writer.
+ * @param path   File to be created.
+ * @param buffer Buffer split in two halves, each must fit the largest block,
+ *               the frame plus 55 bytes.
+ * @param size   Buffer size.
+ * @return Returns true if the file was created or false otherwise.
+ */
+bool TPPcapngOpen(TPPcapng *pcap, const char *path, uint8_t *buffer, uint32_t size);
+
+/*!
+ * ITPCapture given to TP_SetCapture with the writer as its parameter.
+ */
+void TPPcapngCapture(void *param, const TPCaptureInfo *info, const TP_IOVec *parts, uint8_t count);
+
+/*!
+ * Writes the frames still buffered and closes the file. The capture must be
+ * stopped first with TP_SetCapture.
+ *
+ * @param pcap Writer.
+ * @return Returns true if everything was written or false otherwise.
+ */
+bool TPPcapngClose(TPPcapng *pcap);
+
+#endif /* TPPCAPNG_H_ */
@@ -0,0 +1,84 @@
+
+# Decodes the parser trace of a link, the records copied by TP_GetTrace and
+# written to a file as they are in memory:
+#
+#   python3 tools/TraceDump.py trace.bin [--big-endian]
+#
+# Each line shows the tick of the record, the ticks since the previous one, the
+# state which ran and the next one, the bytes of the frame read so far and the
+# status. A state handing over to itself starved, waiting for bytes.
+
+import argparse
+import struct
+import sys
+
+# TP_TRACE_* ids of Trace.h
+STATES = {
+    0: "None",
+    1: "Idle",
+    2: "StartingFrame",
+    3: "Payload",
+    4: "Checksum",
+    5: "NAKRequest",
+    6: "NAKResponse",
+    7: "Datagram",
+    0xFF: "Unknown",
+}
+
+# TPStatus of Status.h
+STATUS = [
+    "TPNone",
+    "TPFailure",
+    "TPSuccess",
+    "TPInactivity",
+    "TPIsRunning",
+    "TPCommandIDUnknown",
+    "TPCommandNotImplemented",
+    "TPErrorChecksum",
+    "TPErrorSending",
+    "TPTimeout",
+    "TPFrameError",
+    "TPBufferOverflow",
+]
+
+# TPTraceRecord: tick, bytesRead, from, to, status, reserved
+RECORD = "IIBBbB"
+
+
+def Decode(data, order):
+    record = struct.Struct(order + RECORD)
+    count = len(data) // record.size
+
+    for i in range(count):
+        yield record.unpack_from(data, i * record.size)
+
+
+def Dump(data, order, out):
+    previous = None
+
+    for tick, bytesRead, source, target, status, _ in Decode(data, order):
+        delta = 0 if previous is None else (tick - previous) & 0xFFFFFFFF
+        previous = tick
+
+        name = STATUS[status + 1] if -1 <= status < len(STATUS) - 1 else str(status)
+        transition = "{} -> {}".format(STATES.get(source, source), STATES.get(target, target))
+        if source == target:
+            transition = "{} starved".format(STATES.get(source, source))
+
+        out.write("{:>10} {:>+8} {: <30} {:>10} {}\n".format(tick, delta, transition, bytesRead, name))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes a TransportProtocol trace")
+    parser.add_argument("file", help="records written from TP_GetTrace")
+    parser.add_argument("--big-endian", action="store_true", help="trace taken on a big endian target")
+    args = parser.parse_args()
+
+    with open(args.file, "rb") as file:
+        data = file.read()
+
+    Dump(data, ">" if args.big_endian else "<", sys.stdout)
+
+
+if __name__ == "__main__":
+    main()